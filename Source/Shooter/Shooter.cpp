@@ -2,5 +2,23 @@
 
 #include "Shooter.h"
 #include "Modules/ModuleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "ShooterAllocationCounter.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, Shooter, "Shooter" );
+LLM_DEFINE_TAG(Shooter);
+
+class FShooterModule : public FDefaultGameModuleImpl
+{
+public:
+	virtual void StartupModule() override
+	{
+		// Swapping GMalloc Is Opt In, So Normal Runs Never Pay For The Counting Proxy
+		if (FParse::Param(FCommandLine::Get(), TEXT("ShooterCountAllocs")))
+		{
+			FShooterAllocationCounter::Install();
+		}
+	}
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FShooterModule, Shooter, "Shooter" );
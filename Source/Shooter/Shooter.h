@@ -3,4 +3,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "HAL/LowLevelMemTracker.h"
 
+DECLARE_STATS_GROUP(TEXT("Shooter"), STATGROUP_Shooter, STATCAT_Advanced);
+
+// Low Level Memory Tracker Tag For Game Code, Run With -llm To See Its Bytes
+LLM_DECLARE_TAG(Shooter);
@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ShooterAimSettings.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+
+const FShooterPenetrationCosts& UShooterAimSettings::GetPenetrationCosts() const
+{
+	if (!bPenetrationCostsBuilt)
+	{
+		BuildPenetrationCosts();
+	}
+	return PenetrationCosts;
+}
+
+void UShooterAimSettings::BuildPenetrationCosts() const
+{
+	// Energy Lost Per Surface = Surface Thickness / Max Depth, Impenetrable When Depth Is 0
+	auto DepthToCost = [this](float Depth)
+	{
+		return Depth > 0.f ? PenetrationSurfaceThickness / Depth : TNumericLimits<float>::Max();
+	};
+
+	PenetrationCosts.Costs.Reset();
+	PenetrationCosts.Costs.Reserve(PenetrationDepths.Num());
+	LoadedPenetrationMaterials.Reset();
+	for (const TPair<TSoftObjectPtr<UPhysicalMaterial>, float>& Entry : PenetrationDepths)
+	{
+		if (UPhysicalMaterial* PhysMaterial = Entry.Key.LoadSynchronous())
+		{
+			LoadedPenetrationMaterials.Add(PhysMaterial);
+			PenetrationCosts.Costs.Add(PhysMaterial, DepthToCost(Entry.Value));
+		}
+	}
+	PenetrationCosts.DefaultCost = DepthToCost(DefaultPenetrationDepth);
+	PenetrationCosts.MaxPenetrations = MaxPenetrations;
+	bPenetrationCostsBuilt = true;
+}
+
+#if WITH_EDITOR
+void UShooterAimSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Characters Hold A Pointer To The Cache, Rebuild In Place So It Stays Valid
+	BuildPenetrationCosts();
+}
+#endif
@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "ShooterAimSettings.generated.h"
+
+class UPhysicalMaterial;
+
+/** Look and Aim Tuning Shared By Every Shooter Character */
+USTRUCT(BlueprintType)
+struct FShooterAimTuning
+{
+	GENERATED_BODY()
+
+	/********** Controller **********/
+
+	// While Not Aiming
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Controller")
+	float HipTurnRate = 90.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Controller")
+	float HipLookUpRate = 90.f;
+
+	// While Aiming
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Controller")
+	float AimingTurnRate = 20.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Controller")
+	float AimingLookUpRate = 20.f;
+
+	/********** Mouse **********/
+
+	// While Not Aiming
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouse", meta = (ClampMin = "0.0", ClampMax = "1.0", UIMIN = "0.0", UIMax = "1.0"))
+	float MouseHipTurnRate = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouse", meta = (ClampMin = "0.0", ClampMax = "1.0", UIMIN = "0.0", UIMax = "1.0"))
+	float MouseHipLookUpRate = 1.f;
+
+	// While Aiming
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouse", meta = (ClampMin = "0.0", ClampMax = "1.0", UIMIN = "0.0", UIMax = "1.0"))
+	float MouseAimingTurnRate = 0.2f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mouse", meta = (ClampMin = "0.0", ClampMax = "1.0", UIMIN = "0.0", UIMax = "1.0"))
+	float MouseAimingLookUpRate = 0.2f;
+
+	/********** Zoom **********/
+
+	// Cameras Zoomed FOV
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zoom")
+	float CameraZoomedFOV = 35.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zoom")
+	float ZoomInterpSpeed = 20.f;
+
+	/********** Firing **********/
+
+	// How Long Crosshairs Stay Spread After A Shot
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Firing")
+	float ShootTimeDuration = 0.05f;
+
+	// Rate Of Automatic Gun Timer
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Firing")
+	float AutomaticFireRate = 0.1f;
+};
+
+/** Energy Each Surface Takes Out Of A Bullet, Built Once From The Settings' Penetration Depths */
+struct FShooterPenetrationCosts
+{
+	TMap<const UPhysicalMaterial*, float> Costs;
+	float DefaultCost = TNumericLimits<float>::Max();
+	int32 MaxPenetrations = 0;
+
+	FORCEINLINE float GetCost(const UPhysicalMaterial* PhysMaterial) const
+	{
+		const float* Cost = Costs.Find(PhysMaterial);
+		return Cost ? *Cost : DefaultCost;
+	}
+};
+
+/**
+ * Project Wide Look and Aim Tuning (Project Settings > Game > Shooter Aim). Characters Reference This Once
+ * Instead Of Storing Their Own Copy, Players That Need Different Values Get A Sparse Override
+ */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Shooter Aim"))
+class SHOOTER_API UShooterAimSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Tuning")
+	FShooterAimTuning DefaultTuning;
+
+	// Max Depth (cm) A Full Energy Bullet Can Travel Through Each Physical Material
+	UPROPERTY(Config, EditAnywhere, Category = "Penetration")
+	TMap<TSoftObjectPtr<UPhysicalMaterial>, float> PenetrationDepths;
+
+	// Depth Used For Materials Not In PenetrationDepths (0 = Impenetrable)
+	UPROPERTY(Config, EditAnywhere, Category = "Penetration", meta = (ClampMin = "0.0"))
+	float DefaultPenetrationDepth = 0.f;
+
+	// Thickness (cm) Assumed For Every Surface Hit
+	UPROPERTY(Config, EditAnywhere, Category = "Penetration", meta = (ClampMin = "0.0"))
+	float PenetrationSurfaceThickness = 10.f;
+
+	// Most Surfaces A Single Bullet Can Pass Through
+	UPROPERTY(Config, EditAnywhere, Category = "Penetration", meta = (ClampMin = "0"))
+	int32 MaxPenetrations = 4;
+
+	/** Per Material Costs, Built On First Use and Shared By Every Character */
+	const FShooterPenetrationCosts& GetPenetrationCosts() const;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	void BuildPenetrationCosts() const;
+
+	// Keeps The Materials Used As Cache Keys Loaded
+	UPROPERTY(Transient)
+	mutable TArray<TObjectPtr<UPhysicalMaterial>> LoadedPenetrationMaterials;
+
+	mutable FShooterPenetrationCosts PenetrationCosts;
+	mutable bool bPenetrationCostsBuilt = false;
+};
@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ShooterAllocationCounter.h"
+#include "HAL/MemoryBase.h"
+
+static thread_local uint64 GThreadAllocationCount = 0;
+
+/** Forwards Everything To The Allocator It Replaced, Counting Calls That Can Hit The Heap */
+class FShooterCountingMalloc final : public FMalloc
+{
+public:
+	explicit FShooterCountingMalloc(FMalloc* InInnerMalloc) :
+		InnerMalloc(InInnerMalloc)
+	{
+	}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		++GThreadAllocationCount;
+		return InnerMalloc->Malloc(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		// Shrinking To Zero Is A Free, Anything Else May Move The Block
+		if (Count > 0)
+		{
+			++GThreadAllocationCount;
+		}
+		return InnerMalloc->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+	virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual void InitializeStatsMetadata() override { InnerMalloc->InitializeStatsMetadata(); }
+	virtual void UpdateStats() override { InnerMalloc->UpdateStats(); }
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+	virtual void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+	virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+	virtual bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+	virtual const TCHAR* GetDescriptiveName() override { return InnerMalloc->GetDescriptiveName(); }
+
+private:
+	FMalloc* InnerMalloc;
+};
+
+// Never Destroyed, Blocks Allocated Through It Can Be Freed Until Process Exit
+static FShooterCountingMalloc* GCountingMalloc = nullptr;
+
+void FShooterAllocationCounter::Install()
+{
+	check(IsInGameThread());
+	if (GCountingMalloc || !GMalloc)
+	{
+		return;
+	}
+
+	// FMalloc Objects Allocate Themselves With The System Allocator, Not Through GMalloc
+	GCountingMalloc = new FShooterCountingMalloc(GMalloc);
+	GMalloc = GCountingMalloc;
+}
+
+bool FShooterAllocationCounter::IsInstalled()
+{
+	return GCountingMalloc != nullptr;
+}
+
+uint64 FShooterAllocationCounter::GetThreadAllocationCount()
+{
+	return GThreadAllocationCount;
+}
@@ -0,0 +1,21 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Counts Heap Allocations Per Thread By Putting A Forwarding Proxy In Front Of GMalloc.
+ * Sample GetThreadAllocationCount Before and After A Scope To Get Its Allocations.
+ */
+class SHOOTER_API FShooterAllocationCounter
+{
+public:
+	/** Installs The Proxy The First Time It's Called, It Stays Installed For The Rest Of The Process. Module Startup Calls It For -ShooterCountAllocs */
+	static void Install();
+
+	static bool IsInstalled();
+
+	/** Mallocs and Growing Reallocs Made On The Calling Thread Since The Proxy Was Installed */
+	static uint64 GetThreadAllocationCount();
+};
@@ -5,6 +5,21 @@
 #include "ShooterCharacter.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Animation/AnimMontage.h"
+#include "Shooter.h"
+
+DECLARE_CYCLE_STAT(TEXT("Fire Animation"), STAT_ShooterFireAnimation, STATGROUP_Shooter);
+
+UShooterAnimInstance::UShooterAnimInstance() :
+	bUseAdditiveRecoil(false),
+	RecoilAlpha(0.f),
+	RecoilAlphaPerShot(0.5f),
+	RecoilRecoverySpeed(15.f),
+	CachedFireMontage(nullptr),
+	CachedFireSectionIndex(INDEX_NONE),
+	CachedFireSectionStartTime(0.f)
+{
+}
 
 void UShooterAnimInstance::UpdateAnimationProperties(float DeltaTime)
 {
@@ -50,9 +65,57 @@ void UShooterAnimInstance::UpdateAnimationProperties(float DeltaTime)
 
 		bAiming = ShooterCharacter->GetAiming(); // Check if ShooterCharacer is Aiming
 	}
+
+	// Let The Additive Recoil Pose Settle Back Between Shots
+	if (RecoilAlpha > 0.f)
+	{
+		RecoilAlpha = FMath::FInterpTo(RecoilAlpha, 0.f, DeltaTime, RecoilRecoverySpeed);
+	}
 }
 
 void UShooterAnimInstance::NativeInitializeAnimation()
 {
 	ShooterCharacter = Cast<AShooterCharacter>(TryGetPawnOwner());
 }
+
+void UShooterAnimInstance::PlayFireAnimation(UAnimMontage* FireMontage, FName SectionName)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ShooterFireAnimation);
+
+	// Additive Recoil Only Needs Its Alpha Kicked, No Montage Instance At All
+	if (bUseAdditiveRecoil)
+	{
+		RecoilAlpha = FMath::Min(RecoilAlpha + RecoilAlphaPerShot, 1.f);
+		return;
+	}
+
+	if (!FireMontage)
+	{
+		return;
+	}
+
+	// Resolve The Section Only When The Montage Or Section Changes
+	if (FireMontage != CachedFireMontage || SectionName != CachedFireSectionName)
+	{
+		CachedFireMontage = FireMontage;
+		CachedFireSectionName = SectionName;
+		CachedFireSectionIndex = FireMontage->GetSectionIndex(SectionName);
+		CachedFireSectionStartTime = 0.f;
+		if (CachedFireSectionIndex != INDEX_NONE)
+		{
+			float SectionEndTime;
+			FireMontage->GetSectionStartAndEndTime(CachedFireSectionIndex, CachedFireSectionStartTime, SectionEndTime);
+		}
+	}
+
+	// Already Playing, Just Rewind The Existing Instance So Blend State Is Kept
+	FAnimMontageInstance* MontageInstance = GetActiveInstanceForMontage(FireMontage);
+	if (MontageInstance && MontageInstance->IsPlaying() && !MontageInstance->IsStopped())
+	{
+		MontageInstance->SetPosition(CachedFireSectionStartTime);
+		return;
+	}
+
+	// First Shot Or Montage Blended Out, Start It Directly At The Section
+	Montage_Play(FireMontage, 1.f, EMontagePlayReturnType::MontageLength, CachedFireSectionStartTime);
+}
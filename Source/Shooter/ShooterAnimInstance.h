@@ -14,12 +14,16 @@ class SHOOTER_API UShooterAnimInstance : public UAnimInstance
 {
 	GENERATED_BODY()
 public:
+	UShooterAnimInstance();
 
 	UFUNCTION(BlueprintCallable)
 	void UpdateAnimationProperties(float DeltaTime);
 
 	virtual void NativeInitializeAnimation() override;
 
+	/** Plays A Shot, Rewinds The Running Fire Montage To The Cached Section Instead Of Restarting It */
+	void PlayFireAnimation(class UAnimMontage* FireMontage, FName SectionName);
+
 private:
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement", meta = (AllowPrivateAccess = "true"))
@@ -44,4 +48,29 @@ private:
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement", meta = (AllowPrivateAccess = "true"))
 	bool bAiming;
+
+	/** Skip Fire Montages and Kick An Additive Recoil Pose Instead, Driven By RecoilAlpha */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat", meta = (AllowPrivateAccess = "true"))
+	bool bUseAdditiveRecoil;
+
+	/** Alpha For The Additive Recoil Node, Set Natively Each Shot and Recovered In UpdateAnimationProperties */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Combat", meta = (AllowPrivateAccess = "true"))
+	float RecoilAlpha;
+
+	/** Recoil Alpha Added Per Shot */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float RecoilAlphaPerShot;
+
+	/** Interp Speed Recoil Alpha Returns To 0 At */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat", meta = (AllowPrivateAccess = "true"))
+	float RecoilRecoverySpeed;
+
+	/** Fire Montage and Section The Cached Index/Start Time Belong To */
+	UPROPERTY()
+	class UAnimMontage* CachedFireMontage;
+	FName CachedFireSectionName;
+
+	// Resolved Once Per Montage/Section Instead Of Looking The Name Up Every Shot
+	int32 CachedFireSectionIndex;
+	float CachedFireSectionStartTime;
 };
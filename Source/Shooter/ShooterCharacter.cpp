@@ -12,28 +12,72 @@
 #include "Engine/SkeletalMeshSocket.h"
 #include "DrawDebugHelpers.h"
 #include "Particles/ParticleSystemComponent.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "ShooterSpread.h"
+#include "ShotTelemetry.h"
+#include "ShooterVisibilitySubsystem.h"
+#include "Misc/App.h"
+#include "ShooterMovementComponent.h"
+#include "ShooterAnimInstance.h"
+#include "Shooter.h"
+#include "EngineUtils.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "ShooterAllocationCounter.h"
+
+DECLARE_CYCLE_STAT(TEXT("Record Shot Telemetry"), STAT_ShooterRecordShotTelemetry, STATGROUP_Shooter);
+DECLARE_CYCLE_STAT(TEXT("Character Tick"), STAT_ShooterCharacterTick, STATGROUP_Shooter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shots Fired"), STAT_ShooterShotsFired, STATGROUP_Shooter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shot Heap Allocations"), STAT_ShooterShotHeapAllocations, STATGROUP_Shooter);
+
+// Built Once Instead Of Hashing The Strings On Every Shot
+static const FName BarrelSocketName(TEXT("BarrelSocket"));
+static const FName BeamTargetParameterName(TEXT("Target"));
+static const FName StartFireSectionName(TEXT("StartFire"));
+
+// Crosshair Spread Terms, Shared With The Server's Spread Lower Bound
+static constexpr float BaseCrosshairSpread = 0.5f;
+static constexpr float MaxCrosshairAimFactor = 0.35f;
+
+// Server Checks On Remote Shots
+static constexpr double ServerFireRateTolerance = 0.8; // Fraction Of AutomaticFireRate Two Shots May Arrive Apart
+static constexpr uint32 MaxShotIndexLead = 4; // Shots The Client May Be Ahead After The Server Dropped Some
+static constexpr uint32 MaxShotIndexLeadBeforeKick = 256;
+static constexpr float ServerVelocityFactorTolerance = 0.5f; // Server Velocity Can Trail The Client's
+static constexpr float NotAimingAimFactorSlack = 0.1f;
+
+/** Crosshair Spread From Horizontal Speed, 0 Standing To 1 At 600 Units/s */
+static float GetCrosshairVelocityFactor(FVector Velocity)
+{
+	FVector2D WalkSpeedRange{ 0.f, 600.f };
+	FVector2D VelocityMultiplierRange{ 0.f, 1.f };
 
-AShooterCharacter::AShooterCharacter() :
-	// Base Rates For Turning/Looking Up
+	Velocity.Z = 0.f; // 0 the Z
+
+	// Gets a Value Within A Mapped Range Between WalkSpeedRange and VelocityMultiplierRange Using Velocity. e.g. If Velocity is 300.f and VelocityMultiplierRange is Between 0.f and 1.f, CrosshairVelocityFactor = 0.5f
+	return FMath::GetMappedRangeValueClamped(WalkSpeedRange, VelocityMultiplierRange, Velocity.Size());
+}
+
+AShooterCharacter::AShooterCharacter(const FObjectInitializer& ObjectInitializer) :
+	Super(ObjectInitializer.SetDefaultSubobjectClass<UShooterMovementComponent>(ACharacter::CharacterMovementComponentName)),
+	// Current Rates For Turning/Looking Up, Set From AimTuning By SetLookRates
 	BaseTurnRate(45.f),
 	BaseLookUpRate(45.f),
-	// Aiming/Not Aiming Rates (Controller)
-	HipTurnRate(90.f),
-	HipLookUpRate(90.f),
-	AimingTurnRate(20.f),
-	AimingLookUpRate(20.f),
-	// Aiming/Not Aiming Rates (Mouse)
-	MouseHipTurnRate(1.f),
-	MouseHipLookUpRate(1.f),
-	MouseAimingTurnRate(0.2f),
-	MouseAimingLookUpRate(0.2f),
+	MouseTurnRate(1.f),
+	MouseLookUpRate(1.f),
+	// Shared Look/Aim Tuning
+	AimTuning(&GetDefault<UShooterAimSettings>()->DefaultTuning),
 	// True When Aiming Weapon
 	bAiming(false),
 	// Camera FOV Values
 	CameraDefaultFOV(0.f),
-	CameraZoomedFOV(35.f),
 	CameraCurrentFOV(0.f),
-	ZoomInterpSpeed(20.f),
+	bCameraZoomManaged(false),
+	bIsViewTarget(false),
+	CameraBoomStaticTickInterval(0.1f),
+	bCameraBoomThrottled(false),
+	bAuthoredCameraBoomCollisionTest(true),
+	bAuthoredCameraBoomLag(false),
+	AuthoredCameraBoomTickInterval(0.f),
 	// Crosshair Spread Factors
 	CrosshairSpreadMultiplier(0.f),
 	CrosshairVelocityFactor(0.f),
@@ -41,12 +85,27 @@ AShooterCharacter::AShooterCharacter() :
 	CrosshairAimFactor(0.f),
 	CrosshairShootingFactor(0.f),
 	// Bullet Fire Timer Variables
-	ShootTimeDuration(0.05f),
 	bFiringBullet(false),
+	CrosshairShootEndTime(0.0),
 	// Automatic Fire Variables
-	AutomaticFireRate(0.1f),
 	bShouldFire(true),
-	bFireButtonPressed(false)
+	AutoFireResetTime(0.0),
+	bFireButtonPressed(false),
+	// Replay Variables
+	ReplayPlaybackFrame(0),
+	bReplayPreviousUseFixedTimeStep(false),
+	ReplayPreviousFixedDeltaTime(0.0),
+	// Spread Variables
+	SpreadSeed(0),
+	SpreadDegreesPerMultiplier(1.5f),
+	ShotIndex(0),
+	ShotSpreadByte(0),
+	LastServerShotTime(-1.0),
+	ShotAimOrigin(FVector::ZeroVector),
+	ShotAimDirection(FVector::ForwardVector),
+	// Penetration Variables
+	bPenetratingShots(false),
+	PenetrationCosts(nullptr)
 
 {
 	PrimaryActorTick.bCanEverTick = true;
@@ -62,6 +121,13 @@ AShooterCharacter::AShooterCharacter() :
 	FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
 	FollowCamera->bUsePawnControlRotation = false;
 
+#if UE_SERVER
+	// Nobody Views Through These On A Dedicated Server, Keep Them For Asset Compatibility But Never Tick Them
+	CameraBoom->PrimaryComponentTick.bCanEverTick = false;
+	CameraBoom->bDoCollisionTest = false;
+	FollowCamera->PrimaryComponentTick.bCanEverTick = false;
+#endif
+
 	/** Don't Rotate When Controller Rotates */
 	bUseControllerRotationPitch = false;
 	bUseControllerRotationYaw = true;
@@ -72,6 +138,7 @@ AShooterCharacter::AShooterCharacter() :
 	GetCharacterMovement()->RotationRate = FRotator(0.f, 540.f, 0.f); // Character Moves In Direction of Input
 	GetCharacterMovement()->JumpZVelocity = 450.f;
 	GetCharacterMovement()->AirControl = 0.1f;
+	ShooterMovement = Cast<UShooterMovementComponent>(GetCharacterMovement());
 }
 
 void AShooterCharacter::BeginPlay()
@@ -91,11 +158,25 @@ void AShooterCharacter::BeginPlay()
 		CameraDefaultFOV = GetFollowCamera()->FieldOfView; //CameraDefaultFOv set to Cameras Default FOV
 		CameraCurrentFOV = CameraDefaultFOV;
 	}
+
+	SetLookRates();
+
+	// Remember What The Blueprint Set Before Activation and Throttling Start Changing It
+	bAuthoredCameraBoomCollisionTest = CameraBoom->bDoCollisionTest;
+	bAuthoredCameraBoomLag = CameraBoom->bEnableCameraLag;
+	AuthoredCameraBoomTickInterval = CameraBoom->PrimaryComponentTick.TickInterval;
+
+	// Characters Spawned Without A Viewer Don't Need Their Boom Probing The World
+	SetCameraBoomActive(IsPlayerViewTarget());
+
+	// Built Once On First Use, Every Character Shares It
+	PenetrationCosts = &GetDefault<UShooterAimSettings>()->GetPenetrationCosts();
 }
 
 void AShooterCharacter::MoveForward(const FInputActionValue& Value)
 {
 	const float CurrentValue = Value.Get<float>();
+	RecordReplayAxis(EShooterReplayAxis::MoveForward, CurrentValue);
 	if (Controller && (CurrentValue != 0.f))
 	{
 		// Gets the Controllers ForwardDirection and stores it in Direction
@@ -110,6 +191,7 @@ void AShooterCharacter::MoveForward(const FInputActionValue& Value)
 void AShooterCharacter::MoveRight(const FInputActionValue& Value)
 {
 	const float CurrentValue = Value.Get<float>();
+	RecordReplayAxis(EShooterReplayAxis::MoveRight, CurrentValue);
 	if ((Controller) && (CurrentValue != 0.f))
 	{
 		// Gets the Controllers ForwardDirection and stores it in Direction
@@ -124,6 +206,7 @@ void AShooterCharacter::MoveRight(const FInputActionValue& Value)
 void AShooterCharacter::TurnAtRate(const FInputActionValue& Value)
 {
 	const float Currentvalue = Value.Get<float>();
+	RecordReplayAxis(EShooterReplayAxis::TurnAtRate, Currentvalue);
 
 	AddControllerYawInput(Currentvalue * BaseTurnRate * GetWorld()->GetDeltaSeconds());
 }
@@ -131,6 +214,7 @@ void AShooterCharacter::TurnAtRate(const FInputActionValue& Value)
 void AShooterCharacter::LookUpAtRate(const FInputActionValue& Value)
 {
 	const float Currentvalue = Value.Get<float>();
+	RecordReplayAxis(EShooterReplayAxis::LookUpAtRate, Currentvalue);
 
 	AddControllerPitchInput(Currentvalue * BaseLookUpRate * GetWorld()->GetDeltaSeconds());
 }
@@ -138,108 +222,247 @@ void AShooterCharacter::LookUpAtRate(const FInputActionValue& Value)
 void AShooterCharacter::Turn(const FInputActionValue& Value)
 {
 	const float CurrentValue = Value.Get<float>();
-	float TurnScaleFactor;
+	RecordReplayAxis(EShooterReplayAxis::Turn, CurrentValue);
 
-	if (bAiming)
-	{
-		TurnScaleFactor = MouseAimingTurnRate; // When Aiming, TurnScaleFactor set to MouseAimingTurnRate
-	}
-	else
-	{
-		TurnScaleFactor = MouseHipTurnRate; // When Not Aiming, TurnScaleFactor set to MouseHipTurnRate
-	}
-	AddControllerYawInput(CurrentValue * TurnScaleFactor);
+	AddControllerYawInput(CurrentValue * MouseTurnRate); // MouseTurnRate Already Matches Aim State
 }
 
 void AShooterCharacter::LookUp(const FInputActionValue& Value)
 {
 	const float CurrentValue = Value.Get<float>();
-	float LookUpScaleFactor;
+	RecordReplayAxis(EShooterReplayAxis::LookUp, CurrentValue);
 
-	if (bAiming)
-	{
-		LookUpScaleFactor = MouseAimingLookUpRate; // When Aiming, LookUpScaleFactor set to MouseAimingLookUpRate
-	}
-	else
-	{
-		LookUpScaleFactor = MouseHipLookUpRate; // When Not Aiming, LookUpScaleFactor set to MouseLookUpRate
-	}
-	AddControllerPitchInput(CurrentValue * LookUpScaleFactor);
+	AddControllerPitchInput(CurrentValue * MouseLookUpRate); // MouseLookUpRate Already Matches Aim State
+}
+
+void AShooterCharacter::JumpButtonPressed()
+{
+	RecordReplayButton(EShooterReplayButton::JumpPressed);
+	Jump();
+}
+
+void AShooterCharacter::JumpButtonReleased()
+{
+	RecordReplayButton(EShooterReplayButton::JumpReleased);
+	StopJumping();
+}
+
+void AShooterCharacter::SprintButtonPressed()
+{
+	RecordReplayButton(EShooterReplayButton::SprintPressed);
+	ShooterMovement->SetSprinting(true);
+}
+
+void AShooterCharacter::SprintButtonReleased()
+{
+	RecordReplayButton(EShooterReplayButton::SprintReleased);
+	ShooterMovement->SetSprinting(false);
 }
 
 void AShooterCharacter::FireWeapon()
 {
+	LLM_SCOPE_BYTAG(Shooter);
+	INC_DWORD_STAT(STAT_ShooterShotsFired);
+
+#if STATS
+	// Every Heap Allocation This Shot Makes On The Game Thread Lands In Shot Heap Allocations, Only Counted When Run With -ShooterCountAllocs
+	const bool bCountAllocations = FShooterAllocationCounter::IsInstalled();
+	const uint64 AllocationsBeforeShot = bCountAllocations ? FShooterAllocationCounter::GetThreadAllocationCount() : 0;
+#endif
+
+	// Spread Comes From Local Crosshair State, So Only The Controlling Machine Quantizes It. Remote Shots Arrive Through ServerFireWeapon
+	if (IsLocallyControlled())
+	{
+		ShotSpreadByte = FShooterSpread::QuantizeSpread(GetSpreadHalfAngle());
+		if (!HasAuthority())
+		{
+			ServerFireWeapon(ShotIndex, ShotSpreadByte);
+		}
+	}
+
+#if !UE_SERVER
 	// Play Fire Sound
 	if (FireSound)
 	{
 		UGameplayStatics::PlaySound2D(this, FireSound);
 	}
+#endif
 
-	const USkeletalMeshSocket* BarrelSocket = GetMesh()->GetSocketByName("BarrelSocket");
+	// Transient Shot Data Goes On The Frame Arena, Popped When This Function Returns
+	FMemMark ShotMark(FMemStack::Get());
+
+	const USkeletalMeshSocket* BarrelSocket = GetMesh()->GetSocketByName(BarrelSocketName);
 	if (BarrelSocket)
 	{
 		// Play Muzzle Flash Effect
 		const FTransform SocketTransform = BarrelSocket->GetSocketTransform(GetMesh()); // Barrel Socket Transform
+#if !UE_SERVER
 		if (MuzzleFlash)
 		{
-			UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), MuzzleFlash, SocketTransform);
+			UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), MuzzleFlash, SocketTransform, false, EPSCPoolMethod::AutoRelease);
 		}
+#endif
 
 		// Create FVector BeamEnd and Populate it With Hit Information
 		FVector BeamEnd;
-		bool bBeamEnd = GetBeamEndLocation(SocketTransform.GetLocation(), BeamEnd);
+		FShotImpactArray ShotImpacts;
+		bool bBeamEnd = GetBeamEndLocation(SocketTransform.GetLocation(), BeamEnd, ShotImpacts);
 		
 		if (bBeamEnd)
 		{
+#if !UE_SERVER
 			if (ImpactParticles)
 			{
-				UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), ImpactParticles, BeamEnd);
+				if (bPenetratingShots)
+				{
+					// Emit Impacts For Every Surface The Bullet Passed Through In One Batch
+					for (const FShotImpact& Impact : ShotImpacts)
+					{
+						UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), ImpactParticles, Impact.Location, Impact.Normal.Rotation(), FVector(1.f), false, EPSCPoolMethod::AutoRelease);
+					}
+				}
+				else
+				{
+					UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), ImpactParticles, BeamEnd, FRotator::ZeroRotator, FVector(1.f), false, EPSCPoolMethod::AutoRelease);
+				}
 			}
 	
 			if (BeamParticles)
 			{
-				UParticleSystemComponent* Beam = UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), BeamParticles, SocketTransform); // Beam Starts At SocketTransform
+				// Pooled So Steady Fire Reuses Finished Components Instead Of Creating New Ones
+				UParticleSystemComponent* Beam = UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), BeamParticles, SocketTransform, false, EPSCPoolMethod::AutoRelease); // Beam Starts At SocketTransform
 				if (Beam)
 				{
-					Beam->SetVectorParameter(FName("Target"), BeamEnd); // Changes Beams End Location (Target) to the BeamEnd, shoots beam from SocketTransform to BeandEndPoint
+					Beam->SetVectorParameter(BeamTargetParameterName, BeamEnd); // Changes Beams End Location (Target) to the BeamEnd, shoots beam from SocketTransform to BeandEndPoint
 				}
 			}
+#endif
+
+			RecordShotTelemetry(SocketTransform.GetLocation(), BeamEnd, ShotImpacts);
 		}
 	}
 
+#if !UE_SERVER
 	// Play Fire Montage
 	UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
-	if (AnimInstance && HipFireMontage)
+	if (UShooterAnimInstance* ShooterAnimInstance = Cast<UShooterAnimInstance>(AnimInstance))
+	{
+		// Rewinds The Running Montage Or Kicks Additive Recoil Instead Of Restarting Per Shot
+		ShooterAnimInstance->PlayFireAnimation(HipFireMontage, StartFireSectionName);
+	}
+	else if (AnimInstance && HipFireMontage)
 	{
 		AnimInstance->Montage_Play(HipFireMontage);
-		AnimInstance->Montage_JumpToSection(FName("StartFire"));
+		AnimInstance->Montage_JumpToSection(StartFireSectionName);
 	}
+#endif
+
+	// Advance The Spread Stream
+	++ShotIndex;
 
 	// Start Bullet Fire Timer For Crosshairs
 	StartCrosshairBulletFire();
+
+#if STATS
+	if (bCountAllocations)
+	{
+		INC_DWORD_STAT_BY(STAT_ShooterShotHeapAllocations, FShooterAllocationCounter::GetThreadAllocationCount() - AllocationsBeforeShot);
+	}
+#endif
 }
 
-bool AShooterCharacter::GetBeamEndLocation(const FVector& MuzzleSocketLocation, FVector& OutBeamLocation)
+bool AShooterCharacter::ServerFireWeapon_Validate(uint32 InShotIndex, uint8 InSpreadByte)
 {
-	// Get Viewport
-	FVector2D ViewportSize;
-	if (GEngine && GEngine->GameViewport)
+	// In Flight Shots After A Resync Can Lag Behind, But No Honest Client Gets This Far Ahead
+	return InShotIndex < ShotIndex || InShotIndex - ShotIndex <= MaxShotIndexLeadBeforeKick;
+}
+
+void AShooterCharacter::ServerFireWeapon_Implementation(uint32 InShotIndex, uint8 InSpreadByte)
+{
+	// Shots Closer Together Than The Fire Rate Allows, Less Some Slack For Network Jitter, Are Dropped
+	const double Now = GetWorld()->GetTimeSeconds();
+	const bool bTooFast = LastServerShotTime >= 0.0 && Now - LastServerShotTime < AimTuning->AutomaticFireRate * ServerFireRateTolerance;
+
+	// Only The Server's Next Index Or A Few Past It (Shots It Dropped) Is Accepted, So A Client Can't Shop For Good Samples
+	const bool bIndexInWindow = InShotIndex >= ShotIndex && InShotIndex - ShotIndex <= MaxShotIndexLead;
+
+	if (bTooFast || !bIndexInWindow)
 	{
-		GEngine->GameViewport->GetViewportSize(ViewportSize);
+		ClientResyncShotIndex(ShotIndex);
+		return;
 	}
 
-	// Get Crosshair Location
-	FVector2D CrosshairLocation(ViewportSize.X / 2.f, ViewportSize.Y / 2.f);
-	//CrosshairLocation.Y -= 50.f; // Raises Crosshair By 50 Units
+	LastServerShotTime = Now;
+	ShotIndex = InShotIndex;
+
+	// Never Tighter Than The Server's Own View Of The Character Allows
+	ShotSpreadByte = FMath::Max(InSpreadByte, FShooterSpread::QuantizeSpread(GetMinSpreadMultiplier() * SpreadDegreesPerMultiplier));
+	FireWeapon();
+}
 
-	// Project The Crosshair From Screen Space to World Space and Fills Variables With Info
+void AShooterCharacter::ClientResyncShotIndex_Implementation(uint32 ServerShotIndex)
+{
+	ShotIndex = ServerShotIndex;
+}
+
+float AShooterCharacter::GetMinSpreadMultiplier() const
+{
+	// In Air and Shooting Factors Only Ever Ramp Up From 0, The Aim Factor Is Taken At Its Full Value While Aim Walking.
+	// When Not Aim Walking, A Little Is Left For The Aim Flag Arriving After The Shot and The Factor Still Decaying
+	const float AimAllowance = ShooterMovement->IsAimWalking() ? MaxCrosshairAimFactor : NotAimingAimFactorSlack;
+	const float VelocityFactor = GetCrosshairVelocityFactor(GetVelocity()) * ServerVelocityFactorTolerance;
+	return FMath::Max(BaseCrosshairSpread + VelocityFactor - AimAllowance, 0.f);
+}
+
+bool AShooterCharacter::GetBeamEndLocation(const FVector& MuzzleSocketLocation, FVector& OutBeamLocation, FShotImpactArray& OutImpacts)
+{
 	FVector CrosshairWorldPosition;
 	FVector CrosshairWorldDirection;
+	bool bScreenToWorld = false;
+
+#if !UE_SERVER
+	// Only A Local Player Has A Crosshair On Screen To Deproject
+	APlayerController* PlayerController = Cast<APlayerController>(Controller);
+	if (PlayerController && PlayerController->IsLocalController())
+	{
+		// Get Viewport
+		FVector2D ViewportSize;
+		if (GEngine && GEngine->GameViewport)
+		{
+			GEngine->GameViewport->GetViewportSize(ViewportSize);
+		}
+
+		// Get Crosshair Location
+		FVector2D CrosshairLocation(ViewportSize.X / 2.f, ViewportSize.Y / 2.f);
+		//CrosshairLocation.Y -= 50.f; // Raises Crosshair By 50 Units
 
-	bool bScreenToWorld = UGameplayStatics::DeprojectScreenToWorld(UGameplayStatics::GetPlayerController(this, 0), CrosshairLocation, CrosshairWorldPosition, CrosshairWorldDirection);
+		// Project The Crosshair From Screen Space to World Space and Fills Variables With Info
+		bScreenToWorld = UGameplayStatics::DeprojectScreenToWorld(PlayerController, CrosshairLocation, CrosshairWorldPosition, CrosshairWorldDirection);
+	}
+	else
+#endif
+	if (Controller)
+	{
+		// Bots, Remote Players On The Server and Dedicated Servers Have No Crosshair, Aim Along The Controller's View Instead
+		FRotator ViewRotation;
+		Controller->GetPlayerViewPoint(CrosshairWorldPosition, ViewRotation);
+		CrosshairWorldDirection = ViewRotation.Vector();
+
+		// Bots Aim Straight At The Target The Visibility Service Cleared
+		if (const AActor* AimTarget = BotAimTarget.Get())
+		{
+			CrosshairWorldDirection = (AimTarget->GetActorLocation() - CrosshairWorldPosition).GetSafeNormal();
+		}
+		bScreenToWorld = true;
+	}
 
 	if (bScreenToWorld)
 	{
+		// Tilt The Shot Inside The Spread Cone For This Shot Index
+		CrosshairWorldDirection = FShooterSpread::ApplySpread(CrosshairWorldDirection, GetSpreadSample(ShotIndex), ShotSpreadByte);
+		ShotAimOrigin = CrosshairWorldPosition;
+		ShotAimDirection = CrosshairWorldDirection;
+
 		FHitResult ScreenTraceHit;
 		const FVector Start{ CrosshairWorldPosition }; // Start is at Crosshair Position
 		const FVector End{ CrosshairWorldPosition + CrosshairWorldDirection * 50'000 }; // End is Crosshair Position 50'000 Units Forward In The Direction Of Crosshair World Direction
@@ -255,6 +478,13 @@ bool AShooterCharacter::GetBeamEndLocation(const FVector& MuzzleSocketLocation,
 			OutBeamLocation = ScreenTraceHit.Location;
 		}
 
+		// Penetrating Shots Replace The Barrel Trace With A Single Multi Trace
+		if (bPenetratingShots)
+		{
+			TracePenetratingShot(MuzzleSocketLocation, OutBeamLocation, OutImpacts);
+			return true;
+		}
+
 		// Perform a Second Trace From Gun Barrel
 		FHitResult WeaponTraceHit;
 		const FVector WeaponTraceStart{ MuzzleSocketLocation };
@@ -266,20 +496,142 @@ bool AShooterCharacter::GetBeamEndLocation(const FVector& MuzzleSocketLocation,
 		{
 			OutBeamLocation = WeaponTraceHit.Location;
 		}
+
+		// Record Whatever Stopped The Beam As The Shot's Only Impact
+		OutImpacts.Reset();
+		const FHitResult& FinalHit = WeaponTraceHit.bBlockingHit ? WeaponTraceHit : ScreenTraceHit;
+		if (FinalHit.bBlockingHit)
+		{
+			FShotImpact& Impact = OutImpacts.AddDefaulted_GetRef();
+			Impact.Location = FinalHit.ImpactPoint;
+			Impact.Normal = FinalHit.ImpactNormal;
+			Impact.PhysMaterial = FinalHit.PhysMaterial.Get();
+			Impact.Actor = FinalHit.GetActor();
+			Impact.BoneName = FinalHit.BoneName;
+			Impact.RemainingEnergy = 0.f;
+		}
 		return true;
 	}
 	return false; // If Deprojection Doesn't Work, Return False
 }
 
+FVector2D AShooterCharacter::GetSpreadSample(uint32 InShotIndex) const
+{
+	if (SpreadPattern.Num() > 0)
+	{
+		return SpreadPattern[InShotIndex % static_cast<uint32>(SpreadPattern.Num())];
+	}
+	return FShooterSpread::GetDiscSample(static_cast<uint32>(SpreadSeed), InShotIndex);
+}
+
+float AShooterCharacter::GetSpreadHalfAngle() const
+{
+	return FMath::Max(CrosshairSpreadMultiplier, 0.f) * SpreadDegreesPerMultiplier;
+}
+
+void AShooterCharacter::TracePenetratingShot(const FVector& MuzzleSocketLocation, FVector& OutBeamLocation, FShotImpactArray& OutImpacts)
+{
+	OutImpacts.Reset();
+	OutImpacts.Reserve(PenetrationCosts->MaxPenetrations + 1);
+	PenetrationHits.Reset();
+
+	// Extend The Barrel Trace Past The Crosshair Hit So Surfaces Behind It Can Be Reached
+	const FVector TraceDirection{ (OutBeamLocation - MuzzleSocketLocation).GetSafeNormal() };
+	const FVector TraceStart{ MuzzleSocketLocation };
+	const FVector TraceEnd{ MuzzleSocketLocation + TraceDirection * 50'000 };
+	OutBeamLocation = TraceEnd;
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ShooterPenetrationTrace), false, this);
+	QueryParams.bReturnPhysicalMaterial = true;
+
+	// Overlap Everything So The Multi Trace Reports Every Surface Instead Of Stopping At The First Block
+	const FCollisionResponseParams ResponseParams(ECollisionResponse::ECR_Overlap);
+	GetWorld()->LineTraceMultiByChannel(PenetrationHits, TraceStart, TraceEnd, ECollisionChannel::ECC_Visibility, QueryParams, ResponseParams);
+
+	// Hits Are Sorted Along The Trace, Walk Them Until The Bullet Runs Out Of Energy
+	float Energy = 1.f;
+	for (const FHitResult& Hit : PenetrationHits)
+	{
+		// Only Surfaces That Would Normally Block The Weapon Trace Count As Impacts
+		const UPrimitiveComponent* HitComponent = Hit.GetComponent();
+		if (!HitComponent || HitComponent->GetCollisionResponseToChannel(ECollisionChannel::ECC_Visibility) != ECollisionResponse::ECR_Block)
+		{
+			continue;
+		}
+
+		Energy -= PenetrationCosts->GetCost(Hit.PhysMaterial.Get());
+
+		FShotImpact& Impact = OutImpacts.AddDefaulted_GetRef();
+		Impact.Location = Hit.ImpactPoint;
+		Impact.Normal = Hit.ImpactNormal;
+		Impact.PhysMaterial = Hit.PhysMaterial.Get();
+		Impact.Actor = Hit.GetActor();
+		Impact.BoneName = Hit.BoneName;
+		Impact.RemainingEnergy = FMath::Max(Energy, 0.f);
+
+		// Bullet Stops Inside This Surface
+		if (Energy <= 0.f || OutImpacts.Num() > PenetrationCosts->MaxPenetrations)
+		{
+			Impact.RemainingEnergy = 0.f;
+			OutBeamLocation = Hit.ImpactPoint;
+			break;
+		}
+	}
+}
+
+void AShooterCharacter::RecordShotTelemetry(const FVector& MuzzleSocketLocation, const FVector& BeamEnd, const FShotImpactArray& Impacts) const
+{
+	FShotTelemetryWriter& TelemetryWriter = FShotTelemetryWriter::Get();
+	if (!TelemetryWriter.IsWriting())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_ShooterRecordShotTelemetry);
+
+	// First Surface Hit Is The One Reported, Penetrated Surfaces Behind It Are Left Out
+	const FShotImpact* FirstImpact = Impacts.Num() > 0 ? &Impacts[0] : nullptr;
+
+	FShotTelemetryRecord Record;
+	Record.ShooterId = GetUniqueID();
+	Record.HitActorId = FirstImpact && FirstImpact->Actor ? FirstImpact->Actor->GetUniqueID() : 0;
+	Record.MuzzleLocation = FVector3f(MuzzleSocketLocation);
+	Record.AimOrigin = FVector3f(ShotAimOrigin);
+	Record.AimDirection = FVector3f(ShotAimDirection);
+	Record.ImpactLocation = FVector3f(FirstImpact ? FirstImpact->Location : BeamEnd);
+	Record.Spread = CrosshairSpreadMultiplier;
+	Record.Distance = FVector::Dist(MuzzleSocketLocation, FVector(Record.ImpactLocation));
+	Record.ShotIndex = ShotIndex;
+	Record.HitBone[0] = '\0';
+	if (FirstImpact && !FirstImpact->BoneName.IsNone())
+	{
+		// Bone Names Are ASCII, Copy Without Building An FString
+		TCHAR BoneName[UE_ARRAY_COUNT(Record.HitBone)];
+		const uint32 BoneNameLength = FirstImpact->BoneName.ToString(BoneName, UE_ARRAY_COUNT(BoneName));
+		for (uint32 Index = 0; Index <= BoneNameLength && Index < UE_ARRAY_COUNT(Record.HitBone); ++Index)
+		{
+			Record.HitBone[Index] = static_cast<ANSICHAR>(BoneName[Index]);
+		}
+		Record.HitBone[UE_ARRAY_COUNT(Record.HitBone) - 1] = '\0';
+	}
+	TelemetryWriter.Record(Record);
+}
+
 void AShooterCharacter::AimingButtonPressed()
 {
+	RecordReplayButton(EShooterReplayButton::AimPressed);
 	bAiming = true;
+	ShooterMovement->SetAimWalking(true); // Slows To Aim Walk Speed, Sent In The Move's Compressed Flags
+	SetLookRates();
 	UE_LOG(LogTemp, Warning, TEXT("Pressed"));
 }
 
 void AShooterCharacter::AimingButtonReleased()
 {
+	RecordReplayButton(EShooterReplayButton::AimReleased);
 	bAiming = false;
+	ShooterMovement->SetAimWalking(false);
+	SetLookRates();
 	UE_LOG(LogTemp, Warning, TEXT("Released"));
 }
 
@@ -288,14 +640,82 @@ void AShooterCharacter::CameraInterpZoom(float DeltaTime)
 	// Set Current Camera Field Of View
 	if (bAiming)
 	{
-		CameraCurrentFOV = FMath::FInterpTo(CameraCurrentFOV, CameraZoomedFOV, DeltaTime, ZoomInterpSpeed); // Interpolates Between CameraCurrentFOV and CameraZoomedFOV Every Frame We Are Aiming
+		ApplyCameraFOV(FMath::FInterpTo(CameraCurrentFOV, AimTuning->CameraZoomedFOV, DeltaTime, AimTuning->ZoomInterpSpeed)); // Interpolates Between CameraCurrentFOV and CameraZoomedFOV Every Frame We Are Aiming
 	}
 	else
 	{
-		CameraCurrentFOV = FMath::FInterpTo(CameraCurrentFOV, CameraDefaultFOV, DeltaTime, ZoomInterpSpeed); // Interpolates Between CameraCurrentFOV and CameraDefaultFOV Every Frame We Are Not Aiming
+		ApplyCameraFOV(FMath::FInterpTo(CameraCurrentFOV, CameraDefaultFOV, DeltaTime, AimTuning->ZoomInterpSpeed)); // Interpolates Between CameraCurrentFOV and CameraDefaultFOV Every Frame We Are Not Aiming
 	}
+}
 
-	GetFollowCamera()->SetFieldOfView(CameraCurrentFOV); // Set Camera FOV to CameraCurrentFOV
+void AShooterCharacter::ApplyCameraFOV(float FOV)
+{
+	// SetFieldOfView Marks The Camera Dirty, Skip It Once The Blend Has Settled
+	if (!FMath::IsNearlyEqual(FOV, CameraCurrentFOV))
+	{
+		CameraCurrentFOV = FOV;
+		GetFollowCamera()->SetFieldOfView(CameraCurrentFOV);
+	}
+}
+
+void AShooterCharacter::BecomeViewTarget(APlayerController* PC)
+{
+	Super::BecomeViewTarget(PC);
+
+	SetCameraBoomActive(true);
+}
+
+void AShooterCharacter::EndViewTarget(APlayerController* PC)
+{
+	Super::EndViewTarget(PC);
+
+	// Another Player May Still Be Viewing Through This Character
+	if (!IsPlayerViewTarget())
+	{
+		bCameraZoomManaged = false;
+		SetCameraBoomActive(false);
+	}
+}
+
+bool AShooterCharacter::IsPlayerViewTarget() const
+{
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		if (PlayerController && PlayerController->GetViewTarget() == this)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void AShooterCharacter::SetCameraBoomActive(bool bActive)
+{
+#if UE_SERVER
+	// Server Side View Targets Are Never Rendered
+	bActive = false;
+#endif
+	bIsViewTarget = bActive;
+	CameraBoom->bDoCollisionTest = bActive && bAuthoredCameraBoomCollisionTest;
+	CameraBoom->SetComponentTickEnabled(bActive);
+	if (!bActive)
+	{
+		SetCameraBoomThrottled(false);
+	}
+}
+
+void AShooterCharacter::SetCameraBoomThrottled(bool bThrottled)
+{
+	if (bThrottled == bCameraBoomThrottled)
+	{
+		return;
+	}
+
+	// Lag Smooths Over The Bigger Steps Between Throttled Probes, Unthrottling Puts The Authored Settings Back
+	bCameraBoomThrottled = bThrottled;
+	CameraBoom->SetComponentTickInterval(bThrottled ? FMath::Max(CameraBoomStaticTickInterval, AuthoredCameraBoomTickInterval) : AuthoredCameraBoomTickInterval);
+	CameraBoom->bEnableCameraLag = bThrottled || bAuthoredCameraBoomLag;
 }
 
 void AShooterCharacter::SetLookRates()
@@ -303,29 +723,40 @@ void AShooterCharacter::SetLookRates()
 	if (bAiming)
 	{
 		// If Aiming, Set Base Rates to Aiming Rates
-		BaseTurnRate = AimingTurnRate;
-		BaseLookUpRate = AimingLookUpRate;
+		BaseTurnRate = AimTuning->AimingTurnRate;
+		BaseLookUpRate = AimTuning->AimingLookUpRate;
+		MouseTurnRate = AimTuning->MouseAimingTurnRate;
+		MouseLookUpRate = AimTuning->MouseAimingLookUpRate;
 	}
 	else
 	{
 		// If Not Aiming, Set Base Rates to Hip Rates
-		BaseTurnRate = HipTurnRate;
-		BaseLookUpRate = HipLookUpRate;
+		BaseTurnRate = AimTuning->HipTurnRate;
+		BaseLookUpRate = AimTuning->HipLookUpRate;
+		MouseTurnRate = AimTuning->MouseHipTurnRate;
+		MouseLookUpRate = AimTuning->MouseHipLookUpRate;
 	}
 }
 
+void AShooterCharacter::SetAimTuningOverride(const FShooterAimTuning& Tuning)
+{
+	AimTuningOverride = MakeUnique<FShooterAimTuning>(Tuning);
+	AimTuning = AimTuningOverride.Get();
+	SetLookRates();
+}
+
+void AShooterCharacter::ClearAimTuningOverride()
+{
+	AimTuningOverride.Reset();
+	AimTuning = &GetDefault<UShooterAimSettings>()->DefaultTuning;
+	SetLookRates();
+}
+
 void AShooterCharacter::CalculateCrosshairSpread(float DeltaTime)
 {
 	/** Crosshair Velocity Factor */
 
-	FVector2D WalkSpeedRange{ 0.f, 600.f };
-	FVector2D VelocityMultiplierRange{ 0.f, 1.f };
-
-	FVector Velocity{ GetVelocity() }; // Get Velocity and 0 the Z
-	Velocity.Z = 0.f;
-	
-	// Gets a Value Within A Mapped Range Between WalkSpeedRange and VelocityMultiplierRange Using Velocity. e.g. If Velocity is 300.f and VelocityMultiplierRange is Between 0.f and 1.f, CrosshairVelocityFactor = 0.5f
-	CrosshairVelocityFactor = FMath::GetMappedRangeValueClamped(WalkSpeedRange, VelocityMultiplierRange, Velocity.Size());
+	CrosshairVelocityFactor = GetCrosshairVelocityFactor(GetVelocity());
 
 	/** Crosshair In Air Factor */
 
@@ -346,7 +777,7 @@ void AShooterCharacter::CalculateCrosshairSpread(float DeltaTime)
 	if (bAiming)
 	{
 		// Shrink Crosshairs Fast While Aiming
-		CrosshairAimFactor = FMath::FInterpTo(CrosshairAimFactor, 0.35, DeltaTime, 30.f);
+		CrosshairAimFactor = FMath::FInterpTo(CrosshairAimFactor, MaxCrosshairAimFactor, DeltaTime, 30.f);
 	}
 	else
 	{
@@ -368,14 +799,15 @@ void AShooterCharacter::CalculateCrosshairSpread(float DeltaTime)
 		CrosshairShootingFactor = FMath::FInterpTo(CrosshairShootingFactor, 0.f, DeltaTime, 15.f);
 	}
 
-	CrosshairSpreadMultiplier = 0.5 + CrosshairVelocityFactor + CrosshairInAirFactor - CrosshairAimFactor + CrosshairShootingFactor;
+	CrosshairSpreadMultiplier = BaseCrosshairSpread + CrosshairVelocityFactor + CrosshairInAirFactor - CrosshairAimFactor + CrosshairShootingFactor;
 }
 
 void AShooterCharacter::StartCrosshairBulletFire()
 {
 	// Bullet Fire Time For Crosshairs
+	// End Time Instead Of A Timer, Re-Arming A Running Timer Every Shot Churns The Timer Manager's Containers
 	bFiringBullet = true;
-	GetWorldTimerManager().SetTimer(CrosshairShootTimer, this, &AShooterCharacter::FinishCrosshairBulletFire, ShootTimeDuration);
+	CrosshairShootEndTime = GetWorld()->GetTimeSeconds() + AimTuning->ShootTimeDuration;
 }
 
 void AShooterCharacter::FinishCrosshairBulletFire()
@@ -387,10 +819,11 @@ void AShooterCharacter::StartFireTimer()
 {
 	if (bShouldFire)
 	{
-		// Fire Weapon, Set bShouldFire to False, Set Timer With AutoFireReset As Callback (Sets bShouldFire to True)
+		// Fire Weapon, Set bShouldFire to False Until AutoFireResetTime, Tick Then Calls AutoFireReset (Sets bShouldFire to True)
+		// End Time Instead Of A Timer For The Same Reason As The Crosshair Spread, This Runs On Every Automatic Shot
 		FireWeapon();
 		bShouldFire = false;
-		GetWorldTimerManager().SetTimer(AutoFireTimer, this, &AShooterCharacter::AutoFireReset, AutomaticFireRate);
+		AutoFireResetTime = GetWorld()->GetTimeSeconds() + AimTuning->AutomaticFireRate;
 	}
 }
 
@@ -406,23 +839,283 @@ void AShooterCharacter::AutoFireReset()
 
 void AShooterCharacter::FireButtonPressed()
 {
+	RecordReplayButton(EShooterReplayButton::FirePressed);
 	bFireButtonPressed = true;
 	StartFireTimer();
 }
 
 void AShooterCharacter::FireButtonReleased()
 {
+	RecordReplayButton(EShooterReplayButton::FireReleased);
 	bFireButtonPressed = false;
 }
 
+bool AShooterCharacter::StartReplayRecording(const FString& Filename)
+{
+	if (ReplayRecording || ReplayPlayback)
+	{
+		return false;
+	}
+
+	// The Live Session Keeps Its Real Timing, Each Frame's Delta Time Is Recorded and Replayed Exactly Instead
+	ReplayRecording = MakeUnique<FShooterReplay>();
+	ReplayRecording->SpawnState = CaptureReplaySpawnState();
+	ReplayRecordingFilename = Filename;
+	PendingReplayFrame = FShooterReplayFrame();
+	return true;
+}
+
+bool AShooterCharacter::StopReplayRecording()
+{
+	if (!ReplayRecording)
+	{
+		return false;
+	}
+
+	ReplayRecording->FinalChecksum = GetReplayChecksum();
+	const bool bSaved = ReplayRecording->SaveToFile(ReplayRecordingFilename);
+	UE_LOG(LogTemp, Display, TEXT("Replay recorded %d frames to %s, checksum %08x"), ReplayRecording->Frames.Num(), *ReplayRecordingFilename, ReplayRecording->FinalChecksum);
+
+	ReplayRecording.Reset();
+	return bSaved;
+}
+
+bool AShooterCharacter::StartReplayPlayback(const FString& Filename)
+{
+	if (ReplayRecording || ReplayPlayback)
+	{
+		return false;
+	}
+
+	TUniquePtr<FShooterReplay> Replay = MakeUnique<FShooterReplay>();
+	if (!Replay->LoadFromFile(Filename))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Could not load replay %s"), *Filename);
+		return false;
+	}
+
+	// The Frame That Feeds Frames[0] Starts After This, Step It By Frames[0]'s Recorded Time
+	BeginReplayFixedTimeStep(Replay->Frames.Num() > 0 ? Replay->Frames[0].DeltaTime : FApp::GetFixedDeltaTime());
+
+	// Recorded Inputs Are The Only Inputs, A Stray Live Key Would Diverge The Checksum
+	SetLiveInputEnabled(false);
+
+	// Put The Character Back Where Recording Started
+	const FShooterReplaySpawnState& SpawnState = Replay->SpawnState;
+	SetActorLocationAndRotation(SpawnState.Location, SpawnState.Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+	if (Controller)
+	{
+		Controller->SetControlRotation(SpawnState.ControlRotation);
+	}
+	GetCharacterMovement()->Velocity = SpawnState.Velocity;
+	bAiming = SpawnState.bAiming;
+	ShooterMovement->SetAimWalking(bAiming);
+	ShooterMovement->SetSprinting(SpawnState.bSprinting);
+	GetCharacterMovement()->SetMovementMode(static_cast<EMovementMode>(SpawnState.MovementMode));
+	ShotIndex = SpawnState.ShotIndex;
+	SetLookRates();
+
+	// Pick The Fire Loop Up Where It Was, A Held Trigger Keeps Firing Once The Timer Resets
+	bFireButtonPressed = SpawnState.bFireButtonPressed;
+	bShouldFire = SpawnState.bShouldFire;
+	AutoFireResetTime = GetWorld()->GetTimeSeconds() + SpawnState.AutoFireTimeRemaining;
+
+	ReplayPlayback = MoveTemp(Replay);
+	ReplayPlaybackFrame = 0;
+	return true;
+}
+
+void AShooterCharacter::BeginReplayFixedTimeStep(double FixedDeltaTime)
+{
+	bReplayPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+	ReplayPreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(FixedDeltaTime);
+}
+
+void AShooterCharacter::EndReplayFixedTimeStep()
+{
+	FApp::SetFixedDeltaTime(ReplayPreviousFixedDeltaTime);
+	FApp::SetUseFixedTimeStep(bReplayPreviousUseFixedTimeStep);
+}
+
+void AShooterCharacter::SetLiveInputEnabled(bool bEnabled)
+{
+	if (APlayerController* PlayerController = Cast<APlayerController>(GetController()))
+	{
+		if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
+		{
+			if (bEnabled)
+			{
+				Subsystem->AddMappingContext(CharacterMappingContext, 0);
+			}
+			else
+			{
+				Subsystem->RemoveMappingContext(CharacterMappingContext);
+			}
+		}
+	}
+}
+
+void AShooterCharacter::TickReplayPlayback()
+{
+	if (!ReplayPlayback)
+	{
+		return;
+	}
+
+	if (ReplayPlaybackFrame >= ReplayPlayback->Frames.Num())
+	{
+		// Every Frame Has Been Simulated, Compare Against The Recording
+		const uint32 Checksum = GetReplayChecksum();
+		if (Checksum == ReplayPlayback->FinalChecksum)
+		{
+			UE_LOG(LogTemp, Display, TEXT("Replay finished after %d frames, checksum %08x matches"), ReplayPlaybackFrame, Checksum);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("Replay diverged after %d frames, checksum %08x expected %08x"), ReplayPlaybackFrame, Checksum, ReplayPlayback->FinalChecksum);
+		}
+
+		ReplayPlayback.Reset();
+		EndReplayFixedTimeStep();
+		SetLiveInputEnabled(true);
+		return;
+	}
+
+	const FShooterReplayFrame& Frame = ReplayPlayback->Frames[ReplayPlaybackFrame++];
+
+	// This Frame's Time Step Is Already Set, Queue The Next Recorded One
+	if (ReplayPlayback->Frames.IsValidIndex(ReplayPlaybackFrame))
+	{
+		FApp::SetFixedDeltaTime(ReplayPlayback->Frames[ReplayPlaybackFrame].DeltaTime);
+	}
+
+	// Same Handlers As Live Input, In EShooterReplayAxis Order
+	using FAxisHandler = void (AShooterCharacter::*)(const FInputActionValue&);
+	static const FAxisHandler AxisHandlers[] =
+	{
+		&AShooterCharacter::MoveForward,
+		&AShooterCharacter::MoveRight,
+		&AShooterCharacter::Turn,
+		&AShooterCharacter::LookUp,
+		&AShooterCharacter::TurnAtRate,
+		&AShooterCharacter::LookUpAtRate
+	};
+	static_assert(UE_ARRAY_COUNT(AxisHandlers) == static_cast<int32>(EShooterReplayAxis::Count), "Every replay axis needs a handler");
+
+	for (int32 Axis = 0; Axis < UE_ARRAY_COUNT(AxisHandlers); ++Axis)
+	{
+		// Enhanced Input Only Triggers Actuated Axes, So Skip Zeros The Same Way
+		if (Frame.Axes[Axis] != 0.f)
+		{
+			(this->*AxisHandlers[Axis])(FInputActionValue(Frame.Axes[Axis]));
+		}
+	}
+
+	using FButtonHandler = void (AShooterCharacter::*)();
+	static const TPair<EShooterReplayButton::Type, FButtonHandler> ButtonHandlers[] =
+	{
+		{ EShooterReplayButton::JumpPressed, &AShooterCharacter::JumpButtonPressed },
+		{ EShooterReplayButton::JumpReleased, &AShooterCharacter::JumpButtonReleased },
+		{ EShooterReplayButton::AimPressed, &AShooterCharacter::AimingButtonPressed },
+		{ EShooterReplayButton::AimReleased, &AShooterCharacter::AimingButtonReleased },
+		{ EShooterReplayButton::FirePressed, &AShooterCharacter::FireButtonPressed },
+		{ EShooterReplayButton::FireReleased, &AShooterCharacter::FireButtonReleased },
+		{ EShooterReplayButton::SprintPressed, &AShooterCharacter::SprintButtonPressed },
+		{ EShooterReplayButton::SprintReleased, &AShooterCharacter::SprintButtonReleased }
+	};
+
+	for (const TPair<EShooterReplayButton::Type, FButtonHandler>& Button : ButtonHandlers)
+	{
+		if (Frame.Buttons & Button.Key)
+		{
+			(this->*Button.Value)();
+		}
+	}
+}
+
+FShooterReplaySpawnState AShooterCharacter::CaptureReplaySpawnState() const
+{
+	FShooterReplaySpawnState SpawnState;
+	SpawnState.Location = GetActorLocation();
+	SpawnState.Rotation = GetActorRotation();
+	SpawnState.ControlRotation = GetControlRotation();
+	SpawnState.Velocity = GetVelocity();
+	SpawnState.bAiming = bAiming;
+	SpawnState.ShotIndex = ShotIndex;
+	SpawnState.bSprinting = ShooterMovement->IsSprinting();
+	SpawnState.MovementMode = GetCharacterMovement()->MovementMode;
+	SpawnState.bFireButtonPressed = bFireButtonPressed;
+	SpawnState.bShouldFire = bShouldFire;
+	SpawnState.AutoFireTimeRemaining = bShouldFire ? 0.f : FMath::Max(static_cast<float>(AutoFireResetTime - GetWorld()->GetTimeSeconds()), 0.f);
+	return SpawnState;
+}
+
+uint32 AShooterCharacter::GetReplayChecksum() const
+{
+	const FShooterReplaySpawnState State = CaptureReplaySpawnState();
+	uint32 Checksum = FCrc::MemCrc32(&State.Location, sizeof(State.Location));
+	Checksum = FCrc::MemCrc32(&State.Rotation, sizeof(State.Rotation), Checksum);
+	Checksum = FCrc::MemCrc32(&State.ControlRotation, sizeof(State.ControlRotation), Checksum);
+	Checksum = FCrc::MemCrc32(&State.Velocity, sizeof(State.Velocity), Checksum);
+	Checksum = FCrc::MemCrc32(&State.bAiming, sizeof(State.bAiming), Checksum);
+	Checksum = FCrc::MemCrc32(&State.bSprinting, sizeof(State.bSprinting), Checksum);
+	Checksum = FCrc::MemCrc32(&State.MovementMode, sizeof(State.MovementMode), Checksum);
+	return FCrc::MemCrc32(&State.ShotIndex, sizeof(State.ShotIndex), Checksum);
+}
+
+void AShooterCharacter::BotFireAt(AActor* Target)
+{
+	// Only Ever Reads The Cache, Traces Are Batched By The Visibility Service
+	UShooterVisibilitySubsystem* Visibility = GetWorld()->GetSubsystem<UShooterVisibilitySubsystem>();
+	const bool bTargetVisible = Target && Visibility && Visibility->QueryVisibility(this, Target) == EShooterVisibility::Visible;
+
+	BotAimTarget = bTargetVisible ? Target : nullptr;
+
+	if (bTargetVisible && !bFireButtonPressed)
+	{
+		FireButtonPressed(); // Starts The StartFireTimer/FireWeapon Loop
+	}
+	else if (!bTargetVisible && bFireButtonPressed)
+	{
+		FireButtonReleased();
+	}
+}
+
 void AShooterCharacter::Tick(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_ShooterCharacterTick);
+
 	Super::Tick(DeltaTime);
 
-	CameraInterpZoom(DeltaTime); // Interps Zoom Based on If Aiming or Not
-	SetLookRates(); // Set BaseTurnRate and BaseLookUpRate Based on aiming
+#if !UE_SERVER
+	// Interps Zoom Based on If Aiming or Not, The Shooter Camera Manager Does This Instead When Present
+	if (bIsViewTarget && !bCameraZoomManaged)
+	{
+		CameraInterpZoom(DeltaTime);
+	}
+#endif
+
+	if (bFiringBullet && GetWorld()->GetTimeSeconds() >= CrosshairShootEndTime)
+	{
+		FinishCrosshairBulletFire();
+	}
+
+	if (!bShouldFire && GetWorld()->GetTimeSeconds() >= AutoFireResetTime)
+	{
+		AutoFireReset();
+	}
+
 	CalculateCrosshairSpread(DeltaTime); // Calculate Crosshair Spread Multiplier
-	
+
+	// Close Out This Frame's Recorded Inputs
+	if (ReplayRecording)
+	{
+		PendingReplayFrame.DeltaTime = DeltaTime;
+		ReplayRecording->Frames.Add(PendingReplayFrame);
+		PendingReplayFrame = FShooterReplayFrame();
+	}
 }
 
 void AShooterCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -437,8 +1130,11 @@ void AShooterCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCo
 		EnhancedInputComponent->BindAction(MoveForwardAction, ETriggerEvent::Triggered, this, &AShooterCharacter::MoveForward);
 		EnhancedInputComponent->BindAction(MoveRightAction, ETriggerEvent::Triggered, this, &AShooterCharacter::MoveRight);
 
-		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Triggered, this, &ACharacter::Jump);
-		EnhancedInputComponent->BindAction(JumpReleaseAction, ETriggerEvent::Triggered, this, &ACharacter::StopJumping);
+		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Triggered, this, &AShooterCharacter::JumpButtonPressed);
+		EnhancedInputComponent->BindAction(JumpReleaseAction, ETriggerEvent::Triggered, this, &AShooterCharacter::JumpButtonReleased);
+
+		EnhancedInputComponent->BindAction(SprintPressedAction, ETriggerEvent::Triggered, this, &AShooterCharacter::SprintButtonPressed);
+		EnhancedInputComponent->BindAction(SprintReleasedAction, ETriggerEvent::Triggered, this, &AShooterCharacter::SprintButtonReleased);
 
 		/** Contrtoller */
 		EnhancedInputComponent->BindAction(TurnRateAction, ETriggerEvent::Triggered, this, &AShooterCharacter::TurnAtRate);
@@ -463,3 +1159,58 @@ float AShooterCharacter::GetCrosshairSpreadMultiplier() const
 	return CrosshairSpreadMultiplier;
 }
 
+static FAutoConsoleCommandWithWorld ReportCharacterMemoryCommand(
+	TEXT("shooter.ReportCharacterMemory"),
+	TEXT("Logs sizeof(AShooterCharacter) and the average counted memory of every shooter character and its components. Compare Game and Server builds on the same map"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		int32 NumCharacters = 0;
+		SIZE_T TotalBytes = 0;
+		for (TActorIterator<AShooterCharacter> It(World); It; ++It)
+		{
+			++NumCharacters;
+			TotalBytes += FArchiveCountMem(*It).GetMax();
+			for (UActorComponent* Component : It->GetComponents())
+			{
+				TotalBytes += FArchiveCountMem(Component).GetMax();
+			}
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("sizeof(AShooterCharacter) = %d bytes, %d characters, %llu bytes per character including components"),
+			static_cast<int32>(sizeof(AShooterCharacter)), NumCharacters, NumCharacters > 0 ? static_cast<uint64>(TotalBytes / NumCharacters) : 0ull);
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs ReplayRecordCommand(
+	TEXT("shooter.Replay.Record"),
+	TEXT("Records the first player's shooter character inputs. Argument is the replay name, saved to Saved/Replays/<Name>.shrep"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		AShooterCharacter* ShooterCharacter = Cast<AShooterCharacter>(UGameplayStatics::GetPlayerCharacter(World, 0));
+		if (ShooterCharacter && Args.Num() > 0)
+		{
+			ShooterCharacter->StartReplayRecording(FShooterReplay::GetReplayFilename(Args[0]));
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld ReplayStopCommand(
+	TEXT("shooter.Replay.Stop"),
+	TEXT("Stops and saves the current replay recording"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (AShooterCharacter* ShooterCharacter = Cast<AShooterCharacter>(UGameplayStatics::GetPlayerCharacter(World, 0)))
+		{
+			ShooterCharacter->StopReplayRecording();
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs ReplayPlayCommand(
+	TEXT("shooter.Replay.Play"),
+	TEXT("Plays a recorded replay on the first player's shooter character, stepping each frame by its recorded delta time, and checks the final state checksum. Works headless with -nullrhi -ExecCmds=\"shooter.Replay.Play <Name>\""),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		AShooterCharacter* ShooterCharacter = Cast<AShooterCharacter>(UGameplayStatics::GetPlayerCharacter(World, 0));
+		if (ShooterCharacter && Args.Num() > 0)
+		{
+			ShooterCharacter->StartReplayPlayback(FShooterReplay::GetReplayFilename(Args[0]));
+		}
+	}));
@@ -5,20 +5,43 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "InputActionValue.h"
+#include "Misc/MemStack.h"
+#include "ShooterAimSettings.h"
+#include "ShooterReplay.h"
 #include "ShooterCharacter.generated.h"
 
 class UInputMappingContext;
 class UInputAction;
+class UPhysicalMaterial;
+class UShooterMovementComponent;
+
+/** A Surface Hit By A Shot, In Order Along The Bullet's Path */
+struct FShotImpact
+{
+	FVector Location;
+	FVector Normal;
+	const UPhysicalMaterial* PhysMaterial;
+	AActor* Actor;
+	FName BoneName;
+	float RemainingEnergy; // Bullet Energy Left After Passing This Surface (0 = Bullet Stopped Here)
+};
+
+/** Impacts For A Single Shot, Lives On The Frame Arena and Is Released When FireWeapon Returns */
+using FShotImpactArray = TArray<FShotImpact, TMemStackAllocator<>>;
 
 UCLASS()
 class SHOOTER_API AShooterCharacter : public ACharacter
 {
 	GENERATED_BODY()
 
+	friend class FShooterFireAllocationTest;
+
 public:
-	AShooterCharacter();
+	AShooterCharacter(const FObjectInitializer& ObjectInitializer);
 	virtual void Tick(float DeltaTime) override;
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
+	virtual void BecomeViewTarget(APlayerController* PC) override;
+	virtual void EndViewTarget(APlayerController* PC) override;
 
 protected:
 	virtual void BeginPlay() override;
@@ -35,13 +58,37 @@ protected:
 	void Turn(const FInputActionValue& Value);
 	void LookUp(const FInputActionValue& Value);
 
+	/** Jump */
+	void JumpButtonPressed();
+	void JumpButtonReleased();
+
+	/** Sprint */
+	void SprintButtonPressed();
+	void SprintButtonReleased();
+
 	/** Weapon */
 	void FireWeapon();
-	bool GetBeamEndLocation(const FVector& MuzzleSocketLocation, FVector& OutBeamLocation);
+
+	/** Replays A Remote Client's Shot On The Server Once Its Fire Rate, Shot Index and Spread Check Out */
+	UFUNCTION(Server, Reliable, WithValidation)
+	void ServerFireWeapon(uint32 InShotIndex, uint8 InSpreadByte);
+
+	/** Puts The Owning Client's Shot Index Back On The Server's After A Rejected Shot */
+	UFUNCTION(Client, Reliable)
+	void ClientResyncShotIndex(uint32 ServerShotIndex);
+
+	/** Smallest Spread Multiplier The Client Could Have Right Now, From The Server's Own Velocity and Aim State */
+	float GetMinSpreadMultiplier() const;
+	bool GetBeamEndLocation(const FVector& MuzzleSocketLocation, FVector& OutBeamLocation, FShotImpactArray& OutImpacts);
+	void TracePenetratingShot(const FVector& MuzzleSocketLocation, FVector& OutBeamLocation, FShotImpactArray& OutImpacts);
+	float GetSpreadHalfAngle() const;
+	void RecordShotTelemetry(const FVector& MuzzleSocketLocation, const FVector& BeamEnd, const FShotImpactArray& Impacts) const;
 	void AimingButtonPressed();
 	void AimingButtonReleased();
 	void CameraInterpZoom(float DeltaTime);
-	void SetLookRates(); // Set Turn and LookUp Rate Based on Aiming
+	void SetCameraBoomActive(bool bActive); // Collision Probe and Boom Tick Only Run While Someone Views Through This Character
+	bool IsPlayerViewTarget() const;
+	void SetLookRates(); // Set Turn and LookUp Rate Based on Aiming, Only Called When Aim State or Tuning Changes
 	void CalculateCrosshairSpread(float DeltaTime);
 	void FireButtonPressed();
 	void FireButtonReleased();
@@ -50,10 +97,8 @@ protected:
 
 	void StartFireTimer();
 
-	UFUNCTION()
 	void FinishCrosshairBulletFire();
 
-	UFUNCTION()
 	void AutoFireReset();
 
 	/** Input Contexts and Actions */
@@ -96,6 +141,12 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
 	UInputAction* AimReleasedAction;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+	UInputAction* SprintPressedAction;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+	UInputAction* SprintReleasedAction;
+
 private:
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"))
@@ -104,6 +155,10 @@ private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"))
 	class UCameraComponent* FollowCamera;
 
+	// CharacterMovement Cast Once To The Shooter Movement Component
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Movement", meta = (AllowPrivateAccess = "true"))
+	UShooterMovementComponent* ShooterMovement;
+
 	/********** Controller **********/
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"))
@@ -112,35 +167,21 @@ private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"))
 	float BaseLookUpRate;
 
-	// While Not Aiming
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"))
-	float HipTurnRate;
-
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"))
-	float HipLookUpRate;
-
-	// While Aiming
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"))
-	float AimingTurnRate;
-
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"))
-	float AimingLookUpRate;
-
 	/********** Mouse **********/
 
-	// While Not Aiming
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0", ClampMax = "1.0", UIMIN = "0.0", UIMax = "1.0"))
-	float MouseHipTurnRate;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"))
+	float MouseTurnRate;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"))
+	float MouseLookUpRate;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0", ClampMax = "1.0", UIMIN = "0.0", UIMax = "1.0"))
-	float MouseHipLookUpRate;
+	/********** Tuning **********/
 
-	// While Aiming
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0", ClampMax = "1.0", UIMIN = "0.0", UIMax = "1.0"))
-	float MouseAimingTurnRate;
+	// Points At The Shared UShooterAimSettings Tuning, Or At AimTuningOverride When Set
+	const FShooterAimTuning* AimTuning;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Camera", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0", ClampMax = "1.0", UIMIN = "0.0", UIMax = "1.0"))
-	float MouseAimingLookUpRate;
+	// Only Allocated For Players With Their Own Tuning
+	TUniquePtr<FShooterAimTuning> AimTuningOverride;
 
 
 	/** Animations */
@@ -171,13 +212,24 @@ private:
 
 	float CameraDefaultFOV; // Camera FOV by Default
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat", meta = (AllowPrivateAccess = "true"))
-	float CameraZoomedFOV; // Cameras Zoomed FOV
-
 	float CameraCurrentFOV; // Current Field OF View This Frame
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat", meta = (AllowPrivateAccess = "true"))
-	float ZoomInterpSpeed;
+	// True While A Shooter Camera Manager Blends FOV, Skips CameraInterpZoom
+	bool bCameraZoomManaged;
+
+	// True While A Player Views Through This Character
+	bool bIsViewTarget;
+
+	// Camera Boom Tick Interval (Seconds) While The View Is Static
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0"))
+	float CameraBoomStaticTickInterval;
+
+	bool bCameraBoomThrottled;
+
+	// Boom Settings Authored On The Blueprint, Cached In BeginPlay So Activating and Throttling Can Put Them Back
+	bool bAuthoredCameraBoomCollisionTest;
+	bool bAuthoredCameraBoomLag;
+	float AuthoredCameraBoomTickInterval;
 
 	/** Crosshairs */
 
@@ -196,32 +248,153 @@ private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Crosshairs", meta = (AllowPrivateAccess = "true")) // Shooting Component For Crosshairs Spread
 	float CrosshairShootingFactor;
 
-	float ShootTimeDuration;
-
 	bool bFiringBullet;
 
-	FTimerHandle CrosshairShootTimer;
+	// World Time The Bullet Fire Crosshair Spread Ends
+	double CrosshairShootEndTime;
 
 	/** Weapon */
 
 	// Right Trigger Pressed
 	bool bFireButtonPressed;
 
-	// True When We Can Fire, False While Waiting For Timer
+	// True When We Can Fire, False While Waiting For AutoFireResetTime
 	bool bShouldFire;
 
-	// Rate Of Automatic Gun Timer
-	float AutomaticFireRate;
+	// World Time The Next Automatic Shot Is Allowed, Checked In Tick
+	double AutoFireResetTime;
+
+	/** Replay */
+
+	// Session Being Recorded, Inputs Gather In PendingReplayFrame Until The End Of Tick
+	TUniquePtr<FShooterReplay> ReplayRecording;
+	FShooterReplayFrame PendingReplayFrame;
+	FString ReplayRecordingFilename;
+
+	// Session Being Played Back And The Next Frame To Feed
+	TUniquePtr<FShooterReplay> ReplayPlayback;
+	int32 ReplayPlaybackFrame;
 
-	/** Sets A Timer Between Gunshots */
-	FTimerHandle AutoFireTimer;
+	// Engine Timestep Settings From Before Playback Switched To The Recorded Steps
+	bool bReplayPreviousUseFixedTimeStep;
+	double ReplayPreviousFixedDeltaTime;
+
+	FORCEINLINE void RecordReplayAxis(EShooterReplayAxis Axis, float Value)
+	{
+		if (ReplayRecording)
+		{
+			PendingReplayFrame.Axes[static_cast<int32>(Axis)] = Value;
+		}
+	}
+
+	FORCEINLINE void RecordReplayButton(EShooterReplayButton::Type Button)
+	{
+		if (ReplayRecording)
+		{
+			PendingReplayFrame.Buttons |= Button;
+		}
+	}
+
+	FShooterReplaySpawnState CaptureReplaySpawnState() const;
+
+	/** Switches Playback To A Fixed Timestep Starting At FixedDeltaTime, EndReplayFixedTimeStep Puts The Previous Settings Back */
+	void BeginReplayFixedTimeStep(double FixedDeltaTime);
+	void EndReplayFixedTimeStep();
+
+	/** Adds Or Removes The Character Mapping Context So Live Input Can't Reach The Handlers During Playback */
+	void SetLiveInputEnabled(bool bEnabled);
+
+	/** Spread */
+
+	// Seeds This Weapon's Spread Stream, Shots Are Reproducible From (SpreadSeed, ShotIndex)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Spread", meta = (AllowPrivateAccess = "true"))
+	int32 SpreadSeed;
+
+	// Cone Half Angle (Degrees) Per Unit Of CrosshairSpreadMultiplier
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Spread", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0"))
+	float SpreadDegreesPerMultiplier;
+
+	// Optional Unit Disc Offsets Used In Order Instead Of The Random Stream, Wraps Around
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Spread", meta = (AllowPrivateAccess = "true"))
+	TArray<FVector2D> SpreadPattern;
+
+	// Number Of Shots Fired, Counter For The Spread Stream. The Server Owns It, Clients Are Resynced After Rejected Shots
+	uint32 ShotIndex;
+
+	// World Time Of The Last Remote Shot The Server Accepted, For Fire Rate Checks
+	double LastServerShotTime;
+
+	// Quantized Cone Size Of The Current Shot, Set By The Firing Machine and Sent With ServerFireWeapon
+	uint8 ShotSpreadByte;
+
+	// Target Set By BotFireAt While It's Visible, Shots Aim At It Instead Of Along The Controller's View
+	TWeakObjectPtr<AActor> BotAimTarget;
+
+	// Aim Ray Of The Last Shot, After Spread
+	FVector ShotAimOrigin;
+	FVector ShotAimDirection;
+
+	/** Penetration */
+
+	// When True, Each Shot Is One Multi Trace That Passes Through Surfaces Using The Shooter Aim Settings' Penetration Depths
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat|Penetration", meta = (AllowPrivateAccess = "true"))
+	bool bPenetratingShots;
+
+	// Points At The Per Material Costs Shared Through UShooterAimSettings, Set In BeginPlay
+	const FShooterPenetrationCosts* PenetrationCosts;
+
+	// Reused Each Shot So The Multi Trace Doesn't Reallocate, Impacts Go On The Frame Arena Instead
+	TArray<FHitResult> PenetrationHits;
 
 public:
 
 	FORCEINLINE USpringArmComponent* GetCameraBoom() const { return CameraBoom; }
 	FORCEINLINE UCameraComponent* GetFollowCamera() const { return FollowCamera; }
 	FORCEINLINE bool GetAiming() const { return bAiming; }
+	FORCEINLINE UShooterMovementComponent* GetShooterMovement() const { return ShooterMovement; }
+	FORCEINLINE float GetCameraDefaultFOV() const { return CameraDefaultFOV; }
+	FORCEINLINE float GetCameraZoomedFOV() const { return AimTuning->CameraZoomedFOV; }
+	FORCEINLINE const FShooterAimTuning& GetAimTuning() const { return *AimTuning; }
+
+	/** Gives This Character Its Own Tuning Instead Of The Shared Settings */
+	UFUNCTION(BlueprintCallable)
+	void SetAimTuningOverride(const FShooterAimTuning& Tuning);
+
+	/** Goes Back To The Shared Settings */
+	UFUNCTION(BlueprintCallable)
+	void ClearAimTuningOverride();
+
+	/** Records Every Input Handled From Now On With Each Frame's Real Delta Time, The Session Keeps Running In Real Time */
+	bool StartReplayRecording(const FString& Filename);
+
+	/** Writes The Recording and Its Final State Checksum */
+	bool StopReplayRecording();
+
+	/** Restores The Recorded Spawn State and Feeds The Recorded Inputs Back Through The Input Handlers */
+	bool StartReplayPlayback(const FString& Filename);
+
+	/** Feeds The Next Replay Frame, Called Where Player Input Is Processed So Timing Matches Recording */
+	void TickReplayPlayback();
+
+	/** Checksum Of Location, Rotation, Velocity, Aim, Sprint, Movement Mode and Shot Count To Detect Replay Divergence */
+	uint32 GetReplayChecksum() const;
+
+	/** Holds The Trigger While The Visibility Service Has Target Cached As Visible, For Bot Testing */
+	UFUNCTION(BlueprintCallable)
+	void BotFireAt(AActor* Target);
+	FORCEINLINE void SetCameraZoomManaged(bool bManaged) { bCameraZoomManaged = bManaged; }
+
+	/** Sets The Follow Camera FOV, Only Touches The Component When The Value Moves */
+	void ApplyCameraFOV(float FOV);
+
+	/** Probes Less Often and Smooths With Lag While The View Is Static */
+	void SetCameraBoomThrottled(bool bThrottled);
 
 	UFUNCTION(BlueprintCallable)
 	float GetCrosshairSpreadMultiplier() const;
+
+	/** Unit Disc Offset For A Given Shot, Same Result On Server and Clients */
+	FVector2D GetSpreadSample(uint32 InShotIndex) const;
+
+	FORCEINLINE uint32 GetShotIndex() const { return ShotIndex; }
 };
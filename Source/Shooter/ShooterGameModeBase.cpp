@@ -2,4 +2,9 @@
 
 
 #include "ShooterGameModeBase.h"
+#include "ShooterPlayerController.h"
 
+AShooterGameModeBase::AShooterGameModeBase()
+{
+	PlayerControllerClass = AShooterPlayerController::StaticClass();
+}
@@ -0,0 +1,273 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ShooterMovementComponent.h"
+#include "Shooter.h"
+#include "GameFramework/Character.h"
+#include "Engine/NetSerialization.h"
+#include "UObject/UObjectIterator.h"
+
+DECLARE_CYCLE_STAT(TEXT("Server Move Processing"), STAT_ShooterServerMove, STATGROUP_Shooter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Client Moves Sent"), STAT_ShooterClientMovesSent, STATGROUP_Shooter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Client Move Bytes Sent"), STAT_ShooterClientMoveBytesSent, STATGROUP_Shooter);
+
+static TAutoConsoleVariable<bool> CVarUseStockMovePacking(
+	TEXT("shooter.Net.UseStockMovePacking"),
+	false,
+	TEXT("Sends client moves with the stock engine packing, set on client and server before connecting to compare move bandwidth"));
+
+// Custom Compressed Flags
+static constexpr uint8 FLAG_AimWalk = FSavedMove_Character::FLAG_Custom_0;
+static constexpr uint8 FLAG_Sprint = FSavedMove_Character::FLAG_Custom_1;
+
+UShooterMovementComponent::UShooterMovementComponent() :
+	AimWalkSpeed(300.f),
+	SprintSpeed(900.f),
+	UnchangedInputSendDeltaTime(1.f / 20.f),
+	bWantsToAimWalk(false),
+	bWantsToSprint(false),
+	ClientMoveBytesThisWindow(0),
+	ClientMoveWindowStart(0.0),
+	ClientMoveBytesPerSecond(0)
+{
+	SetNetworkMoveDataContainer(ShooterMoveDataContainer);
+}
+
+float UShooterMovementComponent::GetMaxSpeed() const
+{
+	if (MovementMode == MOVE_Walking && !IsCrouching())
+	{
+		// Aiming Wins Over Sprinting
+		if (bWantsToAimWalk)
+		{
+			return AimWalkSpeed;
+		}
+		if (bWantsToSprint)
+		{
+			return SprintSpeed;
+		}
+	}
+	return Super::GetMaxSpeed();
+}
+
+void UShooterMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+	Super::UpdateFromCompressedFlags(Flags);
+
+	bWantsToAimWalk = (Flags & FLAG_AimWalk) != 0;
+	bWantsToSprint = (Flags & FLAG_Sprint) != 0;
+}
+
+FNetworkPredictionData_Client* UShooterMovementComponent::GetPredictionData_Client() const
+{
+	if (!ClientPredictionData)
+	{
+		UShooterMovementComponent* MutableThis = const_cast<UShooterMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_Shooter(*this);
+	}
+	return ClientPredictionData;
+}
+
+void UShooterMovementComponent::ServerMovePacked_ClientSend(const FCharacterServerMovePackedBits& PackedBits)
+{
+	// Track Upload Per Client Over One Second Windows, The Stats Are Totals Across Every Client In This Process
+	const int32 MoveBytes = FMath::DivideAndRoundUp(PackedBits.DataBits.Num(), 8);
+	INC_DWORD_STAT(STAT_ShooterClientMovesSent);
+	INC_DWORD_STAT_BY(STAT_ShooterClientMoveBytesSent, MoveBytes);
+	ClientMoveBytesThisWindow += MoveBytes;
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - ClientMoveWindowStart >= 1.0)
+	{
+		ClientMoveBytesPerSecond = FMath::RoundToInt(ClientMoveBytesThisWindow / (Now - ClientMoveWindowStart));
+		ClientMoveBytesThisWindow = 0;
+		ClientMoveWindowStart = Now;
+	}
+
+	Super::ServerMovePacked_ClientSend(PackedBits);
+}
+
+void UShooterMovementComponent::ServerMove_PerformMovement(const FCharacterNetworkMoveData& MoveData)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ShooterServerMove);
+
+	Super::ServerMove_PerformMovement(MoveData);
+}
+
+float UShooterMovementComponent::GetClientNetSendDeltaTime(const APlayerController* PC, const FNetworkPredictionData_Client_Character* ClientData, const FSavedMovePtr& NewMove) const
+{
+	const float NetSendDeltaTime = Super::GetClientNetSendDeltaTime(PC, ClientData, NewMove);
+
+	// NewMove Is Already Queued In SavedMoves, Compare Against The Move Before It
+	FSavedMovePtr PreviousMove = ClientData->LastAckedMove;
+	for (int32 Index = ClientData->SavedMoves.Num() - 1; Index >= 0; --Index)
+	{
+		if (ClientData->SavedMoves[Index] != NewMove)
+		{
+			PreviousMove = ClientData->SavedMoves[Index];
+			break;
+		}
+	}
+
+	// Hold Moves Longer While Input Matches The Previous Move, They Combine Instead Of Going Out Separately
+	if (NewMove.IsValid() && PreviousMove.IsValid()
+		&& NewMove->GetCompressedFlags() == PreviousMove->GetCompressedFlags()
+		&& NewMove->Acceleration.Equals(PreviousMove->Acceleration)
+		&& NewMove->SavedControlRotation.Equals(PreviousMove->SavedControlRotation))
+	{
+		return FMath::Max(NetSendDeltaTime, UnchangedInputSendDeltaTime);
+	}
+	return NetSendDeltaTime;
+}
+
+FVector UShooterMovementComponent::RoundAcceleration(FVector InAccel) const
+{
+	if (CVarUseStockMovePacking.GetValueOnGameThread())
+	{
+		return Super::RoundAcceleration(InAccel);
+	}
+
+	// Match The Whole Unit Packing In FShooterNetworkMoveData So The Client Predicts With What The Server Receives
+	return FVector(FMath::RoundToFloat(InAccel.X), FMath::RoundToFloat(InAccel.Y), FMath::RoundToFloat(InAccel.Z));
+}
+
+/** One Bit When Value Is The Default, Same Scheme The Stock Move Data Uses */
+template<typename ValueType>
+static void SerializeOptionalMoveValue(const bool bIsSaving, FArchive& Ar, ValueType& Value, const ValueType& DefaultValue)
+{
+	bool bNotDefault = bIsSaving && Value != DefaultValue;
+	Ar.SerializeBits(&bNotDefault, 1);
+	if (bNotDefault)
+	{
+		Ar << Value;
+	}
+	else if (!bIsSaving)
+	{
+		Value = DefaultValue;
+	}
+}
+
+bool FShooterNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType)
+{
+	if (CVarUseStockMovePacking.GetValueOnGameThread())
+	{
+		return Super::Serialize(CharacterMovement, Ar, PackageMap, MoveType);
+	}
+
+	NetworkMoveType = MoveType;
+	bool bLocalSuccess = true;
+	const bool bIsSaving = Ar.IsSaving();
+
+	Ar << TimeStamp;
+
+	// Whole Units Instead Of Tenths, RoundAcceleration Already Dropped The Fraction On The Client
+	FVector_NetQuantize WholeAcceleration(Acceleration);
+	WholeAcceleration.NetSerialize(Ar, PackageMap, bLocalSuccess);
+	Acceleration = WholeAcceleration;
+
+	Location.NetSerialize(Ar, PackageMap, bLocalSuccess);
+
+	// Pitch and Yaw As Plain Shorts, Shooter Controllers Never Roll So Roll Isn't Sent
+	uint16 Pitch = FRotator::CompressAxisToShort(ControlRotation.Pitch);
+	uint16 Yaw = FRotator::CompressAxisToShort(ControlRotation.Yaw);
+	Ar << Pitch;
+	Ar << Yaw;
+	if (!bIsSaving)
+	{
+		ControlRotation = FRotator(FRotator::DecompressAxisFromShort(Pitch), FRotator::DecompressAxisFromShort(Yaw), 0.f);
+	}
+
+	SerializeOptionalMoveValue<uint8>(bIsSaving, Ar, CompressedMoveFlags, 0);
+
+	// Base and Mode Only Matter For The Newest Move, Pending and Old Moves In A Dual Or Triple Move Skip Them Like Stock Does
+	if (MoveType == ENetworkMoveType::NewMove)
+	{
+		SerializeOptionalMoveValue<UPrimitiveComponent*>(bIsSaving, Ar, MovementBase, nullptr);
+		SerializeOptionalMoveValue<FName>(bIsSaving, Ar, MovementBaseBoneName, NAME_None);
+		SerializeOptionalMoveValue<uint8>(bIsSaving, Ar, MovementMode, MOVE_Walking);
+	}
+
+	return !Ar.IsError();
+}
+
+FShooterNetworkMoveDataContainer::FShooterNetworkMoveDataContainer()
+{
+	NewMoveData = &ShooterMoveData[0];
+	PendingMoveData = &ShooterMoveData[1];
+	OldMoveData = &ShooterMoveData[2];
+}
+
+void FSavedMove_Shooter::Clear()
+{
+	Super::Clear();
+
+	bWantsToAimWalk = false;
+	bWantsToSprint = false;
+}
+
+uint8 FSavedMove_Shooter::GetCompressedFlags() const
+{
+	uint8 Flags = Super::GetCompressedFlags();
+	Flags |= bWantsToAimWalk ? FLAG_AimWalk : 0;
+	Flags |= bWantsToSprint ? FLAG_Sprint : 0;
+	return Flags;
+}
+
+bool FSavedMove_Shooter::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	// Speed Changes Can't Be Merged Into One Move
+	const FSavedMove_Shooter* NewShooterMove = static_cast<const FSavedMove_Shooter*>(NewMove.Get());
+	if (bWantsToAimWalk != NewShooterMove->bWantsToAimWalk || bWantsToSprint != NewShooterMove->bWantsToSprint)
+	{
+		return false;
+	}
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_Shooter::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	if (const UShooterMovementComponent* MovementComponent = Cast<UShooterMovementComponent>(C->GetCharacterMovement()))
+	{
+		bWantsToAimWalk = MovementComponent->bWantsToAimWalk;
+		bWantsToSprint = MovementComponent->bWantsToSprint;
+	}
+}
+
+void FSavedMove_Shooter::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	// Restore The Flags When Replaying Moves After A Correction
+	if (UShooterMovementComponent* MovementComponent = Cast<UShooterMovementComponent>(C->GetCharacterMovement()))
+	{
+		MovementComponent->bWantsToAimWalk = bWantsToAimWalk;
+		MovementComponent->bWantsToSprint = bWantsToSprint;
+	}
+}
+
+FNetworkPredictionData_Client_Shooter::FNetworkPredictionData_Client_Shooter(const UCharacterMovementComponent& ClientMovement) :
+	Super(ClientMovement)
+{
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_Shooter::AllocateNewMove()
+{
+	return FSavedMovePtr(new FSavedMove_Shooter());
+}
+
+static FAutoConsoleCommand ReportMoveBandwidthCommand(
+	TEXT("shooter.Net.ReportMoveBandwidth"),
+	TEXT("Logs client move bytes per second for every shooter movement component, one line per client when running several clients in one process"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		for (TObjectIterator<UShooterMovementComponent> It; It; ++It)
+		{
+			const UWorld* World = It->GetWorld();
+			if (It->GetOwner() && World && It->GetClientMoveBytesPerSecond() > 0)
+			{
+				UE_LOG(LogTemp, Display, TEXT("%s (%s): %d client move bytes/s"), *It->GetOwner()->GetName(), *World->GetName(), It->GetClientMoveBytesPerSecond());
+			}
+		}
+	}));
@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "ShooterMovementComponent.generated.h"
+
+/** Client Move Data With Whole Unit Acceleration and No Control Roll, Compare Against Stock With shooter.Net.UseStockMovePacking */
+class FShooterNetworkMoveData : public FCharacterNetworkMoveData
+{
+public:
+	typedef FCharacterNetworkMoveData Super;
+
+	virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType) override;
+};
+
+class FShooterNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
+{
+public:
+	FShooterNetworkMoveDataContainer();
+
+	FShooterNetworkMoveData ShooterMoveData[3];
+};
+
+/**
+ * Character Movement With Aim Walk and Sprint Speeds. Both Ride In The Saved Move's Compressed Flags,
+ * So Client Prediction, Server Correction and Replays Agree Without Extra RPCs
+ */
+UCLASS()
+class SHOOTER_API UShooterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+	friend class FSavedMove_Shooter;
+
+public:
+	UShooterMovementComponent();
+
+	void SetAimWalking(bool bAimWalking) { bWantsToAimWalk = bAimWalking; }
+	bool IsAimWalking() const { return bWantsToAimWalk; }
+	void SetSprinting(bool bSprinting) { bWantsToSprint = bSprinting; }
+	bool IsSprinting() const { return bWantsToSprint; }
+
+	virtual float GetMaxSpeed() const override;
+	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+	virtual void ServerMovePacked_ClientSend(const FCharacterServerMovePackedBits& PackedBits) override;
+
+	/** Bytes Per Second This Component Sent In Client Moves Over The Last Full One Second Window */
+	FORCEINLINE int32 GetClientMoveBytesPerSecond() const { return ClientMoveBytesPerSecond; }
+
+protected:
+	virtual void ServerMove_PerformMovement(const FCharacterNetworkMoveData& MoveData) override;
+	virtual float GetClientNetSendDeltaTime(const APlayerController* PC, const FNetworkPredictionData_Client_Character* ClientData, const FSavedMovePtr& NewMove) const override;
+	virtual FVector RoundAcceleration(FVector InAccel) const override;
+
+private:
+	// Max Walk Speed While Aiming
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shooter Movement", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0"))
+	float AimWalkSpeed;
+
+	// Max Walk Speed While Sprinting and Not Aiming
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shooter Movement", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0"))
+	float SprintSpeed;
+
+	// Seconds Between Client Moves While Input Hasn't Changed Since The Last Move
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Shooter Movement", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0"))
+	float UnchangedInputSendDeltaTime;
+
+	uint8 bWantsToAimWalk : 1;
+	uint8 bWantsToSprint : 1;
+
+	// Client Move Bytes Sent In The Current One Second Window, Kept Per Component So Local Multi Client Runs Report Each Client
+	int32 ClientMoveBytesThisWindow;
+	double ClientMoveWindowStart;
+	int32 ClientMoveBytesPerSecond;
+
+	// Storage For The Smaller Move Packing, Registered With SetNetworkMoveDataContainer
+	FShooterNetworkMoveDataContainer ShooterMoveDataContainer;
+};
+
+/** Saved Move That Carries Aim Walk and Sprint In The Custom Compressed Flags */
+class FSavedMove_Shooter : public FSavedMove_Character
+{
+public:
+	typedef FSavedMove_Character Super;
+
+	virtual void Clear() override;
+	virtual uint8 GetCompressedFlags() const override;
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+
+	uint8 bWantsToAimWalk : 1;
+	uint8 bWantsToSprint : 1;
+};
+
+class FNetworkPredictionData_Client_Shooter : public FNetworkPredictionData_Client_Character
+{
+public:
+	typedef FNetworkPredictionData_Client_Character Super;
+
+	FNetworkPredictionData_Client_Shooter(const UCharacterMovementComponent& ClientMovement);
+
+	virtual FSavedMovePtr AllocateNewMove() override;
+};
@@ -0,0 +1,91 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ShooterPlayerCameraManager.h"
+#include "ShooterCharacter.h"
+#include "Shooter.h"
+#include "Curves/CurveFloat.h"
+
+DECLARE_CYCLE_STAT(TEXT("Camera Update"), STAT_ShooterCameraUpdate, STATGROUP_Shooter);
+
+AShooterPlayerCameraManager::AShooterPlayerCameraManager() :
+	ZoomInCurve(nullptr),
+	ZoomOutCurve(nullptr),
+	ZoomInTime(0.15f),
+	ZoomOutTime(0.15f),
+	ZoomAlpha(0.f),
+	StaticDelay(0.25f),
+	StaticTolerance(0.1f),
+	StaticTime(0.f),
+	LastPawnLocation(FVector::ZeroVector),
+	LastControlRotation(FRotator::ZeroRotator)
+{
+}
+
+void AShooterPlayerCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ShooterCameraUpdate);
+
+	Super::UpdateViewTarget(OutVT, DeltaTime);
+
+	AShooterCharacter* ShooterCharacter = Cast<AShooterCharacter>(OutVT.Target);
+	if (ShooterCharacter != ManagedCharacter.Get())
+	{
+		// New View Target, Hand Zoom Back To The Old One and Start Fresh
+		if (AShooterCharacter* OldCharacter = ManagedCharacter.Get())
+		{
+			OldCharacter->SetCameraZoomManaged(false);
+			OldCharacter->SetCameraBoomThrottled(false);
+		}
+		ManagedCharacter = ShooterCharacter;
+		ZoomAlpha = ShooterCharacter && ShooterCharacter->GetAiming() ? 1.f : 0.f;
+		StaticTime = 0.f;
+		if (ShooterCharacter)
+		{
+			ShooterCharacter->SetCameraZoomManaged(true);
+		}
+	}
+
+	if (ShooterCharacter)
+	{
+		const float FOV = UpdateAimZoom(ShooterCharacter, DeltaTime);
+		ShooterCharacter->ApplyCameraFOV(FOV);
+		OutVT.POV.FOV = FOV; // Camera Component Was Read Before The Change, Use The New FOV This Frame
+
+		UpdateBoomThrottle(ShooterCharacter, DeltaTime);
+	}
+}
+
+float AShooterPlayerCameraManager::UpdateAimZoom(const AShooterCharacter* ShooterCharacter, float DeltaTime)
+{
+	const bool bAiming = ShooterCharacter->GetAiming();
+	const float BlendTime = bAiming ? ZoomInTime : ZoomOutTime;
+	const float TargetAlpha = bAiming ? 1.f : 0.f;
+	ZoomAlpha = BlendTime > 0.f ? FMath::FInterpConstantTo(ZoomAlpha, TargetAlpha, DeltaTime, 1.f / BlendTime) : TargetAlpha;
+
+	// Curves Are Authored Over The Direction Of Travel, So Zoom Out Is Evaluated From Its Own Start
+	float Blend = ZoomAlpha;
+	if (bAiming && ZoomInCurve)
+	{
+		Blend = ZoomInCurve->GetFloatValue(ZoomAlpha);
+	}
+	else if (!bAiming && ZoomOutCurve)
+	{
+		Blend = 1.f - ZoomOutCurve->GetFloatValue(1.f - ZoomAlpha);
+	}
+
+	return FMath::Lerp(ShooterCharacter->GetCameraDefaultFOV(), ShooterCharacter->GetCameraZoomedFOV(), Blend);
+}
+
+void AShooterPlayerCameraManager::UpdateBoomThrottle(AShooterCharacter* ShooterCharacter, float DeltaTime)
+{
+	const FVector PawnLocation = ShooterCharacter->GetActorLocation();
+	const FRotator ControlRotation = ShooterCharacter->GetControlRotation();
+
+	const bool bStatic = PawnLocation.Equals(LastPawnLocation, StaticTolerance) && ControlRotation.Equals(LastControlRotation, StaticTolerance);
+	StaticTime = bStatic ? StaticTime + DeltaTime : 0.f;
+	LastPawnLocation = PawnLocation;
+	LastControlRotation = ControlRotation;
+
+	ShooterCharacter->SetCameraBoomThrottled(StaticTime >= StaticDelay);
+}
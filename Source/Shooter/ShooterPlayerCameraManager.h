@@ -0,0 +1,70 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Camera/PlayerCameraManager.h"
+#include "ShooterPlayerCameraManager.generated.h"
+
+class AShooterCharacter;
+class UCurveFloat;
+
+/**
+ * Owns Aim Zoom For The Viewed Shooter Character and Throttles Its Camera Boom While The View Is Static
+ */
+UCLASS()
+class SHOOTER_API AShooterPlayerCameraManager : public APlayerCameraManager
+{
+	GENERATED_BODY()
+
+public:
+	AShooterPlayerCameraManager();
+
+protected:
+	virtual void UpdateViewTarget(FTViewTarget& OutVT, float DeltaTime) override;
+
+private:
+	/** Blends ZoomAlpha Toward The Aim State and Returns The FOV For This Frame */
+	float UpdateAimZoom(const AShooterCharacter* ShooterCharacter, float DeltaTime);
+
+	/** Slows The Camera Boom's Collision Probe Once The View Has Stopped Moving */
+	void UpdateBoomThrottle(AShooterCharacter* ShooterCharacter, float DeltaTime);
+
+	/** Zoom */
+
+	// Shapes The Blend Into Zoomed FOV (Time 0-1 -> Blend 0-1), Linear When Unset
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zoom", meta = (AllowPrivateAccess = "true"))
+	UCurveFloat* ZoomInCurve;
+
+	// Shapes The Blend Back To Default FOV (Time 0-1 -> Blend 0-1), Linear When Unset
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zoom", meta = (AllowPrivateAccess = "true"))
+	UCurveFloat* ZoomOutCurve;
+
+	// Seconds To Fully Zoom In
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zoom", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0"))
+	float ZoomInTime;
+
+	// Seconds To Fully Zoom Out
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zoom", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0"))
+	float ZoomOutTime;
+
+	// 0 = Default FOV, 1 = Zoomed FOV
+	float ZoomAlpha;
+
+	/** Camera Boom */
+
+	// Seconds The View Must Stay Still Before The Boom Is Throttled
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Boom", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0"))
+	float StaticDelay;
+
+	// Movement (cm) and Rotation (Degrees) Below This Count As Static
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Boom", meta = (AllowPrivateAccess = "true"), meta = (ClampMin = "0.0"))
+	float StaticTolerance;
+
+	float StaticTime;
+	FVector LastPawnLocation;
+	FRotator LastControlRotation;
+
+	// Character Currently Being Driven By This Manager
+	TWeakObjectPtr<AShooterCharacter> ManagedCharacter;
+};
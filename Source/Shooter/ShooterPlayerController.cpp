@@ -0,0 +1,22 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ShooterPlayerController.h"
+#include "ShooterPlayerCameraManager.h"
+#include "ShooterCharacter.h"
+
+AShooterPlayerController::AShooterPlayerController()
+{
+	PlayerCameraManagerClass = AShooterPlayerCameraManager::StaticClass();
+}
+
+void AShooterPlayerController::PostProcessInput(const float DeltaTime, const bool bGamePaused)
+{
+	Super::PostProcessInput(DeltaTime, bGamePaused);
+
+	// Replayed Inputs Go In Right After Live Input Handlers Run, Before Rotation Is Applied, So Frames Line Up With The Recording
+	if (AShooterCharacter* ShooterCharacter = Cast<AShooterCharacter>(GetPawn()))
+	{
+		ShooterCharacter->TickReplayPlayback();
+	}
+}
@@ -0,0 +1,21 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/PlayerController.h"
+#include "ShooterPlayerController.generated.h"
+
+/**
+ * 
+ */
+UCLASS()
+class SHOOTER_API AShooterPlayerController : public APlayerController
+{
+	GENERATED_BODY()
+
+public:
+	AShooterPlayerController();
+
+	virtual void PostProcessInput(const float DeltaTime, const bool bGamePaused) override;
+};
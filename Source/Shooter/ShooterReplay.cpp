@@ -0,0 +1,124 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ShooterReplay.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+bool FShooterReplay::SaveToFile(const FString& Filename)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Serialize(Writer);
+	return FFileHelper::SaveArrayToFile(Bytes, *Filename);
+}
+
+bool FShooterReplay::LoadFromFile(const FString& Filename)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Filename))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	return Serialize(Reader) && !Reader.IsError();
+}
+
+FString FShooterReplay::GetReplayFilename(const FString& Name)
+{
+	return FPaths::ProjectSavedDir() / TEXT("Replays") / Name + TEXT(".shrep");
+}
+
+bool FShooterReplay::Serialize(FArchive& Ar)
+{
+	uint32 Magic = FileMagic;
+	uint32 Version = CurrentVersion;
+	Ar << Magic;
+	Ar << Version;
+	if (Magic != FileMagic || Version != CurrentVersion)
+	{
+		return false;
+	}
+
+	Ar << SpawnState.Location;
+	Ar << SpawnState.Rotation;
+	Ar << SpawnState.ControlRotation;
+	Ar << SpawnState.Velocity;
+	Ar << SpawnState.bAiming;
+	Ar << SpawnState.ShotIndex;
+	Ar << SpawnState.bSprinting;
+	Ar << SpawnState.MovementMode;
+	Ar << SpawnState.bFireButtonPressed;
+	Ar << SpawnState.bShouldFire;
+	Ar << SpawnState.AutoFireTimeRemaining;
+	Ar << FinalChecksum;
+
+	int32 NumFrames = Frames.Num();
+	Ar << NumFrames;
+	if (Ar.IsLoading())
+	{
+		// Every Frame Is At Least Its Change Mask Byte, So A Count Past The Bytes Left Means A Truncated Or Corrupt File
+		if (NumFrames < 0 || Ar.IsError() || NumFrames > Ar.TotalSize() - Ar.Tell())
+		{
+			return false;
+		}
+		Frames.SetNum(NumFrames);
+	}
+
+	// Mask Bits 0-5 Flag Changed Axes, Bit 6 A Changed Delta Time, Bit 7 Buttons
+	constexpr int32 NumAxes = static_cast<int32>(EShooterReplayAxis::Count);
+	constexpr uint8 DeltaTimeBit = 1 << 6;
+	constexpr uint8 ButtonsBit = 1 << 7;
+
+	FShooterReplayFrame Previous;
+	for (FShooterReplayFrame& Frame : Frames)
+	{
+		uint8 ChangeMask = 0;
+		if (Ar.IsSaving())
+		{
+			for (int32 Axis = 0; Axis < NumAxes; ++Axis)
+			{
+				ChangeMask |= Frame.Axes[Axis] != Previous.Axes[Axis] ? (1 << Axis) : 0;
+			}
+			ChangeMask |= Frame.DeltaTime != Previous.DeltaTime ? DeltaTimeBit : 0;
+			ChangeMask |= Frame.Buttons != 0 ? ButtonsBit : 0;
+		}
+		Ar << ChangeMask;
+
+		for (int32 Axis = 0; Axis < NumAxes; ++Axis)
+		{
+			if (ChangeMask & (1 << Axis))
+			{
+				Ar << Frame.Axes[Axis];
+			}
+			else
+			{
+				Frame.Axes[Axis] = Previous.Axes[Axis];
+			}
+		}
+
+		if (ChangeMask & DeltaTimeBit)
+		{
+			Ar << Frame.DeltaTime;
+		}
+		else
+		{
+			Frame.DeltaTime = Previous.DeltaTime;
+		}
+
+		if (ChangeMask & ButtonsBit)
+		{
+			Ar << Frame.Buttons;
+		}
+		else
+		{
+			Frame.Buttons = 0;
+		}
+
+		Previous = Frame;
+	}
+	return true;
+}
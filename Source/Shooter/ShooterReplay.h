@@ -0,0 +1,81 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Axis Inputs Captured Each Frame, In File Order */
+enum class EShooterReplayAxis : uint8
+{
+	MoveForward,
+	MoveRight,
+	Turn,
+	LookUp,
+	TurnAtRate,
+	LookUpAtRate,
+	Count
+};
+
+/** Button Events Captured Each Frame */
+namespace EShooterReplayButton
+{
+	enum Type : uint8
+	{
+		FirePressed = 1 << 0,
+		FireReleased = 1 << 1,
+		AimPressed = 1 << 2,
+		AimReleased = 1 << 3,
+		JumpPressed = 1 << 4,
+		JumpReleased = 1 << 5,
+		SprintPressed = 1 << 6,
+		SprintReleased = 1 << 7
+	};
+}
+
+/** Inputs Handled During One Frame, Axes That Didn't Trigger Stay 0 */
+struct FShooterReplayFrame
+{
+	float Axes[static_cast<int32>(EShooterReplayAxis::Count)] = {};
+	uint8 Buttons = 0;
+	float DeltaTime = 0.f; // Real Frame Time While Recording, Playback Steps Each Frame By Exactly This
+};
+
+/** Character State When Recording Started, Restored Before Playback */
+struct FShooterReplaySpawnState
+{
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	FRotator ControlRotation = FRotator::ZeroRotator;
+	FVector Velocity = FVector::ZeroVector;
+	bool bAiming = false;
+	uint32 ShotIndex = 0;
+	bool bSprinting = false;
+	uint8 MovementMode = 0; // EMovementMode, Recordings Started Mid Jump Resume Falling
+	bool bFireButtonPressed = false;
+	bool bShouldFire = true;
+	float AutoFireTimeRemaining = 0.f; // Time Until The Next Automatic Shot Is Allowed, 0 When Not Waiting
+};
+
+/**
+ * A Recorded Combat Session. Frames Are Delta Encoded On Disk: Each Frame Is A Change Mask Byte
+ * Followed Only By The Axes and Delta Time That Changed and The Buttons When Any Were Pressed
+ */
+struct SHOOTER_API FShooterReplay
+{
+	static constexpr uint32 FileMagic = 0x50455253; // "SREP"
+	static constexpr uint32 CurrentVersion = 3;
+
+	FShooterReplaySpawnState SpawnState;
+	TArray<FShooterReplayFrame> Frames;
+	uint32 FinalChecksum = 0; // Character State Checksum When Recording Stopped, Compared After Playback
+
+	bool SaveToFile(const FString& Filename);
+	bool LoadFromFile(const FString& Filename);
+
+	/** Saved Replays Live In Saved/Replays/<Name>.shrep */
+	static FString GetReplayFilename(const FString& Name);
+
+private:
+	/** Reads Or Writes Depending On The Archive */
+	bool Serialize(FArchive& Ar);
+};
@@ -0,0 +1,67 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ShooterSpread.h"
+
+uint32 FShooterSpread::Hash(uint32 Seed, uint32 ShotIndex, uint32 Stream)
+{
+	// Combine Inputs Then Run The Murmur3 Finalizer To Mix Every Bit
+	uint32 H = Seed ^ (ShotIndex * 0x9E3779B9u) ^ (Stream * 0x85EBCA77u);
+	H ^= H >> 16;
+	H *= 0x85EBCA6Bu;
+	H ^= H >> 13;
+	H *= 0xC2B2AE35u;
+	H ^= H >> 16;
+	return H;
+}
+
+FVector2D FShooterSpread::GetDiscSample(uint32 Seed, uint32 ShotIndex)
+{
+	// 24 Bits Convert To Float Exactly, Giving A Value In [-1, 1)
+	auto ToSignedUnit = [](uint32 Bits)
+	{
+		return static_cast<float>(Bits >> 8) * (2.f / 16'777'216.f) - 1.f;
+	};
+
+	// Rejection Sample The Square So No Trig Is Needed, Each Attempt Uses The Next Two Streams
+	constexpr uint32 MaxAttempts = 16;
+	for (uint32 Attempt = 0; Attempt < MaxAttempts; ++Attempt)
+	{
+		const float X = ToSignedUnit(Hash(Seed, ShotIndex, Attempt * 2));
+		const float Y = ToSignedUnit(Hash(Seed, ShotIndex, Attempt * 2 + 1));
+		if (X * X + Y * Y <= 1.f)
+		{
+			return FVector2D(X, Y);
+		}
+	}
+	return FVector2D::ZeroVector; // (1 - Pi/4)^16 Chance, Shoot Straight
+}
+
+uint8 FShooterSpread::QuantizeSpread(float HalfAngleDegrees)
+{
+	// Tan Isn't Bit Identical Across Math Libraries, Which Is Fine Here Because Only The Rounded Byte Leaves This Machine
+	const float ConeRadius = FMath::Tan(FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.f, 89.f)));
+	return static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(ConeRadius / ConeRadiusStep), 0, 255));
+}
+
+float FShooterSpread::GetConeRadius(uint8 SpreadByte)
+{
+	return static_cast<float>(SpreadByte) * ConeRadiusStep;
+}
+
+FVector FShooterSpread::ApplySpread(const FVector& AimDirection, const FVector2D& DiscSample, uint8 SpreadByte)
+{
+	if (SpreadByte == 0)
+	{
+		return AimDirection;
+	}
+
+	// Axes Use Only Add, Multiply, Divide and Sqrt, Which IEEE 754 Rounds Exactly. Results Match Between Builds
+	// That Compile The Same Operations In The Same Order (No Fused Multiply-Add Contraction), Not Across Any Two Compilers
+	FVector Right;
+	FVector Up;
+	AimDirection.FindBestAxisVectors(Right, Up);
+
+	const double ConeRadius = GetConeRadius(SpreadByte);
+	return (AimDirection + (Right * DiscSample.X + Up * DiscSample.Y) * ConeRadius).GetSafeNormal();
+}
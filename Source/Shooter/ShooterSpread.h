@@ -0,0 +1,31 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Deterministic Weapon Spread. Every Value Comes From A Counter Based Hash Of (Seed, ShotIndex),
+ * So Any Machine Given The Same Seed And Shot Index Rebuilds The Same Cone Offset Without It Being Sent.
+ * The Cone Size Is Sent As A Single Quantized Byte, Since The Crosshair Spread It Comes From Is Local State.
+ */
+struct SHOOTER_API FShooterSpread
+{
+	/** Cone Radius (Tangent Of The Half Angle) Per Spread Byte Step, A Power Of Two So Dequantizing Is Exact */
+	static constexpr float ConeRadiusStep = 1.f / 1024.f;
+
+	/** Hashes Seed, Shot Index and Stream Into A Well Mixed 32 Bit Value */
+	static uint32 Hash(uint32 Seed, uint32 ShotIndex, uint32 Stream);
+
+	/** Point Inside The Unit Disc For This Shot. Uses Integer Math and Basic Float Ops Only So It's Bit Identical Everywhere */
+	static FVector2D GetDiscSample(uint32 Seed, uint32 ShotIndex);
+
+	/** Quantizes A Cone Half Angle To The Byte Sent With A Shot, Only The Firing Machine Calls This */
+	static uint8 QuantizeSpread(float HalfAngleDegrees);
+
+	/** Cone Radius For A Spread Byte, Same On Every Machine */
+	static float GetConeRadius(uint8 SpreadByte);
+
+	/** Tilts AimDirection By DiscSample Scaled To The Cone Encoded In SpreadByte */
+	static FVector ApplySpread(const FVector& AimDirection, const FVector2D& DiscSample, uint8 SpreadByte);
+};
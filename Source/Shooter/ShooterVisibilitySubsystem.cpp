@@ -0,0 +1,164 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ShooterVisibilitySubsystem.h"
+#include "Shooter.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Visibility Queries Issued"), STAT_ShooterVisibilityTracesIssued, STATGROUP_Shooter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Visibility Trace Budget"), STAT_ShooterVisibilityTraceBudget, STATGROUP_Shooter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Visibility Cache Hits"), STAT_ShooterVisibilityCacheHits, STATGROUP_Shooter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Visibility Cache Misses"), STAT_ShooterVisibilityCacheMisses, STATGROUP_Shooter);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Visibility Pairs Pending"), STAT_ShooterVisibilityPending, STATGROUP_Shooter);
+
+static TAutoConsoleVariable<int32> CVarVisibilityTraceBudget(
+	TEXT("shooter.Visibility.TraceBudget"),
+	32,
+	TEXT("Most line of sight traces the visibility service issues per frame"));
+
+static TAutoConsoleVariable<float> CVarVisibilityTimeToLive(
+	TEXT("shooter.Visibility.TimeToLive"),
+	0.25f,
+	TEXT("Seconds a line of sight result is reused before it is traced again"));
+
+UShooterVisibilitySubsystem::FPairKey::FPairKey(const AActor* A, const AActor* B)
+{
+	const FObjectKey KeyA(A);
+	const FObjectKey KeyB(B);
+	First = KeyA < KeyB ? KeyA : KeyB;
+	Second = KeyA < KeyB ? KeyB : KeyA;
+}
+
+EShooterVisibility UShooterVisibilitySubsystem::QueryVisibility(const AActor* Observer, const AActor* Target)
+{
+	if (!Observer || !Target)
+	{
+		return EShooterVisibility::Unknown;
+	}
+
+	const FPairKey Key(Observer, Target);
+	FPairEntry& Entry = Cache.FindOrAdd(Key);
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	const bool bFresh = Entry.Result != EShooterVisibility::Unknown && Now - Entry.ResultTime <= CVarVisibilityTimeToLive.GetValueOnGameThread();
+	if (bFresh)
+	{
+		INC_DWORD_STAT(STAT_ShooterVisibilityCacheHits);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_ShooterVisibilityCacheMisses);
+		if (!Entry.bQueued)
+		{
+			// Both Orders Of The Pair Land Here, Only The First One Queues A Trace
+			Entry.First = Observer;
+			Entry.Second = Target;
+			Entry.bQueued = true;
+			PendingPairs.Add(Key);
+			INC_DWORD_STAT(STAT_ShooterVisibilityPending);
+		}
+	}
+
+	// A Stale Answer Is Still Better Than None While The New Trace Is Pending
+	return Entry.Result;
+}
+
+void UShooterVisibilitySubsystem::Tick(float DeltaTime)
+{
+	const int32 TraceBudget = FMath::Max(CVarVisibilityTraceBudget.GetValueOnGameThread(), 0);
+	SET_DWORD_STAT(STAT_ShooterVisibilityTraceBudget, TraceBudget);
+
+	int32 TracesIssued = 0;
+	while (TracesIssued < TraceBudget && !PendingPairs.IsEmpty())
+	{
+		const FPairKey Key = PendingPairs.PopFrontValue();
+		DEC_DWORD_STAT(STAT_ShooterVisibilityPending);
+
+		FPairEntry* Entry = Cache.Find(Key);
+		if (!Entry)
+		{
+			continue;
+		}
+
+		// Drop Pairs Whose Actors Have Gone Away
+		if (!Entry->First.IsValid() || !Entry->Second.IsValid())
+		{
+			Cache.Remove(Key);
+			continue;
+		}
+
+		IssueTrace(Key, *Entry);
+		++TracesIssued;
+	}
+	INC_DWORD_STAT_BY(STAT_ShooterVisibilityTracesIssued, TracesIssued);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (Now - LastPruneTime > 1.0)
+	{
+		PruneCache(Now);
+		LastPruneTime = Now;
+	}
+}
+
+TStatId UShooterVisibilitySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UShooterVisibilitySubsystem, STATGROUP_Shooter);
+}
+
+void UShooterVisibilitySubsystem::IssueTrace(const FPairKey& Key, const FPairEntry& Entry)
+{
+	// Trace Eye To Eye So The Result Holds Both Ways
+	FVector StartLocation;
+	FVector EndLocation;
+	FRotator EyesRotation;
+	Entry.First->GetActorEyesViewPoint(StartLocation, EyesRotation);
+	Entry.Second->GetActorEyesViewPoint(EndLocation, EyesRotation);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ShooterVisibility), false);
+	QueryParams.AddIgnoredActor(Entry.First.Get());
+	QueryParams.AddIgnoredActor(Entry.Second.Get());
+
+	if (!TraceDelegate.IsBound())
+	{
+		TraceDelegate.BindUObject(this, &UShooterVisibilitySubsystem::OnTraceCompleted);
+	}
+
+	const int32 InFlightIndex = InFlightPairs.Add(Key);
+	GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, StartLocation, EndLocation, ECollisionChannel::ECC_Visibility,
+		QueryParams, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, static_cast<uint32>(InFlightIndex));
+}
+
+void UShooterVisibilitySubsystem::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	const int32 InFlightIndex = static_cast<int32>(Datum.UserData);
+	if (!InFlightPairs.IsValidIndex(InFlightIndex))
+	{
+		return;
+	}
+
+	const FPairKey Key = InFlightPairs[InFlightIndex];
+	InFlightPairs.RemoveAt(InFlightIndex);
+
+	if (FPairEntry* Entry = Cache.Find(Key))
+	{
+		const bool bBlocked = Datum.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+		Entry->Result = bBlocked ? EShooterVisibility::Occluded : EShooterVisibility::Visible;
+		Entry->ResultTime = GetWorld()->GetTimeSeconds();
+		Entry->bQueued = false;
+	}
+}
+
+void UShooterVisibilitySubsystem::PruneCache(double Now)
+{
+	// Forget Pairs Nobody Has Asked About For A While
+	const double MaxAge = FMath::Max(CVarVisibilityTimeToLive.GetValueOnGameThread() * 4.0, 1.0);
+	for (auto It = Cache.CreateIterator(); It; ++It)
+	{
+		const FPairEntry& Entry = It.Value();
+		if (!Entry.bQueued && (Now - Entry.ResultTime > MaxAge || !Entry.First.IsValid() || !Entry.Second.IsValid()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
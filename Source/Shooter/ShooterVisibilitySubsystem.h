@@ -0,0 +1,73 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/RingBuffer.h"
+#include "UObject/ObjectKey.h"
+#include "WorldCollision.h"
+#include "ShooterVisibilitySubsystem.generated.h"
+
+enum class EShooterVisibility : uint8
+{
+	Unknown, // Never Traced Yet
+	Visible,
+	Occluded
+};
+
+/**
+ * Batched Line Of Sight For Bots. Callers Ask For (Observer, Target) Pairs and Get The Cached Answer Straight Away.
+ * Missing Or Expired Pairs Are Queued, Symmetric Pairs Share One Entry, and Queued Pairs Go Out As Async Traces
+ * A Budgeted Number Per Frame
+ */
+UCLASS()
+class SHOOTER_API UShooterVisibilitySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Cached Visibility Between Observer and Target, Queues A Trace When Missing Or Older Than The Time To Live */
+	EShooterVisibility QueryVisibility(const AActor* Observer, const AActor* Target);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	/** Order Independent Key So (A, B) and (B, A) Share A Cache Entry */
+	struct FPairKey
+	{
+		FObjectKey First;
+		FObjectKey Second;
+
+		FPairKey(const AActor* A, const AActor* B);
+
+		bool operator==(const FPairKey& Other) const { return First == Other.First && Second == Other.Second; }
+		friend uint32 GetTypeHash(const FPairKey& Key) { return HashCombine(GetTypeHash(Key.First), GetTypeHash(Key.Second)); }
+	};
+
+	struct FPairEntry
+	{
+		TWeakObjectPtr<const AActor> First;
+		TWeakObjectPtr<const AActor> Second;
+		EShooterVisibility Result = EShooterVisibility::Unknown;
+		double ResultTime = 0.0;
+		bool bQueued = false; // Waiting In PendingPairs Or In Flight
+	};
+
+	void IssueTrace(const FPairKey& Key, const FPairEntry& Entry);
+	void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+	void PruneCache(double Now);
+
+	TMap<FPairKey, FPairEntry> Cache;
+
+	// Pairs Waiting For A Trace, Oldest First
+	TRingBuffer<FPairKey> PendingPairs;
+
+	// Pairs With A Trace In Flight, Indexed By The Trace's UserData
+	TSparseArray<FPairKey> InFlightPairs;
+
+	FTraceDelegate TraceDelegate;
+	double LastPruneTime = 0.0;
+};
@@ -0,0 +1,193 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ShotTelemetry.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+FShotTelemetryWriter& FShotTelemetryWriter::Get()
+{
+	static FShotTelemetryWriter Writer;
+	return Writer;
+}
+
+bool FShotTelemetryWriter::StartWriting(const FString& Filename)
+{
+	if (IsWriting())
+	{
+		return false;
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Filename));
+	FileHandle.Reset(PlatformFile.OpenWrite(*Filename));
+	if (!FileHandle)
+	{
+		return false;
+	}
+
+	FShotTelemetryFileHeader Header;
+	Header.Magic = FShotTelemetryFileHeader::FileMagic;
+	Header.SchemaVersion = FShotTelemetryFileHeader::CurrentSchemaVersion;
+	Header.RecordSize = sizeof(FShotTelemetryRecord);
+	Header.StartUtcTicks = FDateTime::UtcNow().GetTicks();
+	FileHandle->Write(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+
+	// Make Sure The Tail Of The File Is Written If The Game Exits While Recording
+	static bool bRegisteredExit = false;
+	if (!bRegisteredExit)
+	{
+		FCoreDelegates::OnPreExit.AddLambda([]() { FShotTelemetryWriter::Get().StopWriting(); });
+		bRegisteredExit = true;
+	}
+
+	StartTime = FPlatformTime::Seconds();
+	DroppedRecords = 0;
+	bStopRequested = false;
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	bWriting = true;
+	Thread = FRunnableThread::Create(this, TEXT("ShotTelemetryWriter"), 0, TPri_BelowNormal);
+	return true;
+}
+
+void FShotTelemetryWriter::StopWriting()
+{
+	if (!IsWriting())
+	{
+		return;
+	}
+
+	bWriting = false;
+	Stop();
+	if (Thread)
+	{
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+	FileHandle.Reset();
+
+	if (DroppedRecords > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Shot telemetry dropped %u records, queues were full"), DroppedRecords.load());
+	}
+}
+
+void FShotTelemetryWriter::Record(FShotTelemetryRecord& Record)
+{
+	if (!IsWriting())
+	{
+		return;
+	}
+
+	Record.Timestamp = FPlatformTime::Seconds() - StartTime;
+	if (!GetThreadBuffer().Queue.Enqueue(Record))
+	{
+		++DroppedRecords;
+	}
+}
+
+FShotTelemetryWriter::FThreadBuffer& FShotTelemetryWriter::GetThreadBuffer()
+{
+	static thread_local FThreadBuffer* ThreadBuffer = nullptr;
+	if (!ThreadBuffer)
+	{
+		// First Record On This Thread, Register A Queue For It
+		FScopeLock Lock(&BuffersLock);
+		ThreadBuffer = Buffers.Add_GetRef(MakeUnique<FThreadBuffer>()).Get();
+	}
+	return *ThreadBuffer;
+}
+
+uint32 FShotTelemetryWriter::Run()
+{
+	while (!bStopRequested)
+	{
+		WakeEvent->Wait(250);
+		Flush();
+	}
+
+	// Catch Records Queued While Stopping
+	Flush();
+	return 0;
+}
+
+void FShotTelemetryWriter::Stop()
+{
+	bStopRequested = true;
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FShotTelemetryWriter::Flush()
+{
+	PendingRecords.Reset();
+	{
+		FScopeLock Lock(&BuffersLock);
+		for (const TUniquePtr<FThreadBuffer>& Buffer : Buffers)
+		{
+			FShotTelemetryRecord Record;
+			while (Buffer->Queue.Dequeue(Record))
+			{
+				PendingRecords.Add(Record);
+			}
+		}
+	}
+
+	// Write Outside The Lock So New Threads Can Still Register
+	if (PendingRecords.Num() > 0 && FileHandle)
+	{
+		FileHandle->Write(reinterpret_cast<const uint8*>(PendingRecords.GetData()), PendingRecords.Num() * sizeof(FShotTelemetryRecord));
+		FileHandle->Flush();
+	}
+}
+
+bool FShotTelemetryReader::Load(const FString& Filename, FShotTelemetryFileHeader& OutHeader, TArray<FShotTelemetryRecord>& OutRecords)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Filename) || Bytes.Num() < sizeof(FShotTelemetryFileHeader))
+	{
+		return false;
+	}
+
+	FMemory::Memcpy(&OutHeader, Bytes.GetData(), sizeof(FShotTelemetryFileHeader));
+	if (OutHeader.Magic != FShotTelemetryFileHeader::FileMagic
+		|| OutHeader.SchemaVersion != FShotTelemetryFileHeader::CurrentSchemaVersion
+		|| OutHeader.RecordSize != sizeof(FShotTelemetryRecord))
+	{
+		return false;
+	}
+
+	// A Partially Written Last Record Is Ignored
+	const int32 NumRecords = (Bytes.Num() - sizeof(FShotTelemetryFileHeader)) / sizeof(FShotTelemetryRecord);
+	OutRecords.SetNumUninitialized(NumRecords);
+	FMemory::Memcpy(OutRecords.GetData(), Bytes.GetData() + sizeof(FShotTelemetryFileHeader), NumRecords * sizeof(FShotTelemetryRecord));
+	return true;
+}
+
+static FAutoConsoleCommand ShotTelemetryStartCommand(
+	TEXT("shooter.Telemetry.Start"),
+	TEXT("Starts writing shot telemetry. Optional argument is the output file, defaults to Saved/Telemetry/Shots_<time>.bin"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FString Filename = Args.Num() > 0 ? Args[0] : FPaths::ProjectSavedDir() / TEXT("Telemetry") / FString::Printf(TEXT("Shots_%s.bin"), *FDateTime::Now().ToString());
+		if (FShotTelemetryWriter::Get().StartWriting(Filename))
+		{
+			UE_LOG(LogTemp, Log, TEXT("Shot telemetry writing to %s"), *Filename);
+		}
+	}));
+
+static FAutoConsoleCommand ShotTelemetryStopCommand(
+	TEXT("shooter.Telemetry.Stop"),
+	TEXT("Flushes and closes the shot telemetry file"),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FShotTelemetryWriter::Get().StopWriting();
+	}));
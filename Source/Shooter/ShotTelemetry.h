@@ -0,0 +1,106 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/CircularQueue.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include <atomic>
+
+class FRunnableThread;
+class FEvent;
+
+/** Written Once At The Start Of Every Shot Telemetry File */
+struct FShotTelemetryFileHeader
+{
+	static constexpr uint32 FileMagic = 0x4C544853; // "SHTL"
+	static constexpr uint16 CurrentSchemaVersion = 1;
+
+	uint32 Magic;
+	uint16 SchemaVersion;
+	uint16 RecordSize;
+	int64 StartUtcTicks; // FDateTime Ticks When Recording Started, Record Timestamps Are Relative To This
+};
+static_assert(sizeof(FShotTelemetryFileHeader) == 16, "Shot telemetry header layout changed, bump CurrentSchemaVersion");
+
+/** One Fixed Size Record Per Shot */
+struct FShotTelemetryRecord
+{
+	double Timestamp; // Seconds Since Recording Started
+	uint32 ShooterId;
+	uint32 HitActorId; // 0 When Nothing Was Hit
+	FVector3f MuzzleLocation;
+	FVector3f AimOrigin;
+	FVector3f AimDirection;
+	FVector3f ImpactLocation;
+	float Spread;
+	float Distance; // Muzzle To Impact
+	uint32 ShotIndex;
+	ANSICHAR HitBone[36]; // Null Terminated, Empty When No Bone Was Hit
+};
+static_assert(sizeof(FShotTelemetryRecord) == 112, "Shot telemetry record layout changed, bump CurrentSchemaVersion");
+
+/**
+ * Appends Shot Records Into Per Thread Lock Free Queues and Flushes Them To A Binary File On A Background Thread.
+ * Recording Only Takes A Lock The First Time A Thread Records.
+ */
+class SHOOTER_API FShotTelemetryWriter : public FRunnable
+{
+public:
+	static FShotTelemetryWriter& Get();
+
+	/** Opens Filename, Writes The Header and Starts The Flush Thread */
+	bool StartWriting(const FString& Filename);
+
+	/** Flushes Remaining Records and Closes The File */
+	void StopWriting();
+
+	FORCEINLINE bool IsWriting() const { return bWriting.load(std::memory_order_relaxed); }
+
+	/** Queues A Record On The Calling Thread, Drops It If That Thread's Queue Is Full */
+	void Record(FShotTelemetryRecord& Record);
+
+	FORCEINLINE double GetStartTime() const { return StartTime; }
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	FShotTelemetryWriter() = default;
+
+	/** Single Producer (Owning Thread) Single Consumer (Flush Thread) Queue */
+	struct FThreadBuffer
+	{
+		static constexpr uint32 Capacity = 4096; // Must Be A Power Of Two
+
+		FThreadBuffer() : Queue(Capacity) {}
+
+		TCircularQueue<FShotTelemetryRecord> Queue;
+	};
+
+	FThreadBuffer& GetThreadBuffer();
+	void Flush();
+
+	// Buffers Live For The Whole Program So Thread Local Pointers To Them Never Dangle
+	TArray<TUniquePtr<FThreadBuffer>> Buffers;
+	FCriticalSection BuffersLock;
+
+	// Drained Records Waiting To Be Written, Only Touched By The Flush Thread
+	TArray<FShotTelemetryRecord> PendingRecords;
+
+	TUniquePtr<IFileHandle> FileHandle;
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	std::atomic<bool> bWriting{ false };
+	std::atomic<bool> bStopRequested{ false };
+	std::atomic<uint32> DroppedRecords{ 0 };
+	double StartTime = 0.0;
+};
+
+/** Reads A Shot Telemetry File Back Into Memory */
+struct SHOOTER_API FShotTelemetryReader
+{
+	static bool Load(const FString& Filename, FShotTelemetryFileHeader& OutHeader, TArray<FShotTelemetryRecord>& OutRecords);
+};
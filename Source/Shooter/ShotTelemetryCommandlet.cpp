@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ShotTelemetryCommandlet.h"
+#include "ShotTelemetry.h"
+#include "Misc/FileHelper.h"
+
+UShotTelemetryCommandlet::UShotTelemetryCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UShotTelemetryCommandlet::Main(const FString& Params)
+{
+	FString InFile;
+	FString OutFile;
+	FString Mode{ TEXT("Csv") };
+	float CellSize = 100.f;
+	FParse::Value(*Params, TEXT("In="), InFile);
+	FParse::Value(*Params, TEXT("Out="), OutFile);
+	FParse::Value(*Params, TEXT("Mode="), Mode);
+	FParse::Value(*Params, TEXT("CellSize="), CellSize);
+
+	if (InFile.IsEmpty() || OutFile.IsEmpty() || CellSize <= 0.f)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Usage: -run=ShotTelemetry -In=<File.bin> -Out=<File.csv> [-Mode=Csv|Heatmap] [-CellSize=100]"));
+		return 1;
+	}
+
+	FShotTelemetryFileHeader Header;
+	TArray<FShotTelemetryRecord> Records;
+	if (!FShotTelemetryReader::Load(InFile, Header, Records))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Could not read shot telemetry from %s (missing file or schema mismatch)"), *InFile);
+		return 1;
+	}
+
+	TArray<FString> Lines;
+	if (Mode.Equals(TEXT("Heatmap"), ESearchCase::IgnoreCase))
+	{
+		// Bucket Impact Locations Into A 2D Grid
+		struct FCell
+		{
+			int32 Shots = 0;
+			int32 Hits = 0;
+		};
+		TMap<FIntPoint, FCell> Cells;
+		for (const FShotTelemetryRecord& Record : Records)
+		{
+			const FIntPoint CellKey{ FMath::FloorToInt(Record.ImpactLocation.X / CellSize), FMath::FloorToInt(Record.ImpactLocation.Y / CellSize) };
+			FCell& Cell = Cells.FindOrAdd(CellKey);
+			++Cell.Shots;
+			Cell.Hits += Record.HitActorId != 0 ? 1 : 0;
+		}
+
+		Lines.Reserve(Cells.Num() + 1);
+		Lines.Add(TEXT("CellX,CellY,MinX,MinY,Shots,Hits"));
+		for (const TPair<FIntPoint, FCell>& Cell : Cells)
+		{
+			Lines.Add(FString::Printf(TEXT("%d,%d,%.1f,%.1f,%d,%d"), Cell.Key.X, Cell.Key.Y, Cell.Key.X * CellSize, Cell.Key.Y * CellSize, Cell.Value.Shots, Cell.Value.Hits));
+		}
+	}
+	else
+	{
+		Lines.Reserve(Records.Num() + 1);
+		Lines.Add(TEXT("Timestamp,ShooterId,ShotIndex,MuzzleX,MuzzleY,MuzzleZ,AimOriginX,AimOriginY,AimOriginZ,AimDirX,AimDirY,AimDirZ,ImpactX,ImpactY,ImpactZ,Spread,Distance,HitActorId,HitBone"));
+		for (const FShotTelemetryRecord& Record : Records)
+		{
+			Lines.Add(FString::Printf(TEXT("%.4f,%u,%u,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.5f,%.5f,%.5f,%.2f,%.2f,%.2f,%.4f,%.2f,%u,%hs"),
+				Record.Timestamp, Record.ShooterId, Record.ShotIndex,
+				Record.MuzzleLocation.X, Record.MuzzleLocation.Y, Record.MuzzleLocation.Z,
+				Record.AimOrigin.X, Record.AimOrigin.Y, Record.AimOrigin.Z,
+				Record.AimDirection.X, Record.AimDirection.Y, Record.AimDirection.Z,
+				Record.ImpactLocation.X, Record.ImpactLocation.Y, Record.ImpactLocation.Z,
+				Record.Spread, Record.Distance, Record.HitActorId, Record.HitBone));
+		}
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *OutFile))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Could not write %s"), *OutFile);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Converted %d shots from %s to %s"), Records.Num(), *InFile, *OutFile);
+	return 0;
+}
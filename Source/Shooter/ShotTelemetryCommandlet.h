@@ -0,0 +1,23 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ShotTelemetryCommandlet.generated.h"
+
+/**
+ * Converts A Shot Telemetry File For Offline Analysis
+ * -run=ShotTelemetry -In=<File.bin> -Out=<File.csv> [-Mode=Csv|Heatmap] [-CellSize=100]
+ * Csv Writes One Row Per Shot, Heatmap Writes Shot and Hit Counts Per XY Grid Cell Of The Impact Location
+ */
+UCLASS()
+class SHOOTER_API UShotTelemetryCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UShotTelemetryCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
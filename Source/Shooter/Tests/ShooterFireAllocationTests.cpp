@@ -0,0 +1,132 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/SkeletalMeshSocket.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Particles/ParticleSystem.h"
+#include "AIController.h"
+#include "ShooterCharacter.h"
+#include "ShooterAllocationCounter.h"
+#include "ShotTelemetry.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShooterFireAllocationTest, "Shooter.Combat.ZeroAllocationsPerShot", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FShooterFireAllocationTest::RunTest(const FString& Parameters)
+{
+	FShooterAllocationCounter::Install();
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	FShotTelemetryWriter& TelemetryWriter = FShotTelemetryWriter::Get();
+	const bool bStartedTelemetry = !TelemetryWriter.IsWriting() && TelemetryWriter.StartWriting(FPaths::AutomationTransientDir() / TEXT("ShooterFireAllocationTest.bin"));
+
+	auto Cleanup = [World, &TelemetryWriter, bStartedTelemetry]()
+	{
+		if (bStartedTelemetry)
+		{
+			TelemetryWriter.StopWriting();
+		}
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	};
+
+	// A Row Of Cubes In Front Of The Character So Every Shot Penetrates Several Surfaces
+	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	AStaticMeshActor* FirstWall = nullptr;
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		AStaticMeshActor* Wall = World->SpawnActor<AStaticMeshActor>(FVector(300.f + Index * 200.f, 0.f, 0.f), FRotator::ZeroRotator);
+		Wall->GetStaticMeshComponent()->SetStaticMesh(CubeMesh);
+		FirstWall = FirstWall ? FirstWall : Wall;
+	}
+
+	// The Game's Character Blueprint Brings The Gun Mesh With Its Barrel Socket, The Fire Montage and The Anim Blueprint
+	UClass* CharacterClass = LoadClass<AShooterCharacter>(nullptr, TEXT("/Game/_Game/Character/ShooterCharacterBP.ShooterCharacterBP_C"));
+	AShooterCharacter* Character = CharacterClass ? World->SpawnActor<AShooterCharacter>(CharacterClass, FVector::ZeroVector, FRotator::ZeroRotator) : nullptr;
+	if (!TestNotNull(TEXT("Character blueprint spawned"), Character))
+	{
+		Cleanup();
+		return false;
+	}
+
+	// Without These FireWeapon Skips The Trace, Emitter Or Montage Half Of The Shot and The Test Would Pass Trivially
+	const bool bHasBarrelSocket = TestNotNull(TEXT("Character mesh has a BarrelSocket"), Character->GetMesh()->GetSocketByName(TEXT("BarrelSocket")));
+	const bool bHasAnimInstance = TestNotNull(TEXT("Character mesh has an anim instance"), Character->GetMesh()->GetAnimInstance());
+	const bool bHasFireMontage = TestNotNull(TEXT("Character has a hip fire montage"), Character->HipFireMontage);
+	if (!TestTrue(TEXT("Shot telemetry is writing"), TelemetryWriter.IsWriting()) || !bHasBarrelSocket || !bHasAnimInstance || !bHasFireMontage)
+	{
+		Cleanup();
+		return false;
+	}
+
+	// Empty Templates Still Go Through The Emitter Pool When The Blueprint Leaves A Slot Unset
+	for (UParticleSystem** Emitter : { &Character->MuzzleFlash, &Character->ImpactParticles, &Character->BeamParticles })
+	{
+		if (!*Emitter)
+		{
+			*Emitter = NewObject<UParticleSystem>(GetTransientPackage());
+		}
+	}
+	Character->bPenetratingShots = true;
+
+	// A Bot Controller Makes The Shot Locally Controlled and Aims It Along The Controller's View At The Walls
+	AAIController* BotController = World->SpawnActor<AAIController>();
+	BotController->Possess(Character);
+	Character->BotAimTarget = FirstWall;
+
+	// The Test Calls AutoFireReset Itself Where Tick Would, So Only The Fire Loop Is Counted and Not The Rest Of The World Tick
+	Character->SetActorTickEnabled(false);
+	const float FireInterval = Character->AimTuning->AutomaticFireRate;
+
+	// Trigger Pull Fires The First Shot Through StartFireTimer, Every Later Shot Comes From The Held Trigger Loop
+	auto FireBurst = [World, Character, FireInterval](int32 NumShots) -> uint64
+	{
+		const uint64 AllocationsBefore = FShooterAllocationCounter::GetThreadAllocationCount();
+		Character->FireButtonPressed();
+		uint64 Allocations = FShooterAllocationCounter::GetThreadAllocationCount() - AllocationsBefore;
+
+		for (int32 Shot = 1; Shot < NumShots; ++Shot)
+		{
+			// Particles, Montages and The Emitter Pool Advance Here, Outside The Counted Window
+			World->Tick(LEVELTICK_All, FireInterval);
+
+			const uint64 ShotAllocationsBefore = FShooterAllocationCounter::GetThreadAllocationCount();
+			Character->AutoFireReset();
+			Allocations += FShooterAllocationCounter::GetThreadAllocationCount() - ShotAllocationsBefore;
+		}
+
+		Character->FireButtonReleased();
+		World->Tick(LEVELTICK_All, FireInterval);
+		Character->AutoFireReset();
+		return Allocations;
+	};
+
+	// Warm Up So Reused Buffers, The Frame Arena, The Telemetry Queue and The Emitter Pool Reach Their Steady Size
+	constexpr int32 WarmUpShots = 16;
+	constexpr int32 MeasuredShots = 64;
+	FireBurst(WarmUpShots);
+
+	const uint32 ShotIndexBefore = Character->ShotIndex;
+	const uint64 Allocations = FireBurst(MeasuredShots);
+
+	TestEqual(TEXT("Every measured shot went through FireWeapon"), static_cast<int32>(Character->ShotIndex - ShotIndexBefore), MeasuredShots);
+	TestTrue(FString::Printf(TEXT("No heap allocations over %d warmed up shots (got %llu)"), MeasuredShots, Allocations), Allocations == 0);
+
+	Cleanup();
+	return true;
+}
+
+#endif
@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "ShooterSpread.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FShooterSpreadDeterminismTest, "Shooter.Spread.Determinism", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FShooterSpreadDeterminismTest::RunTest(const FString& Parameters)
+{
+	/** A Shot's Inputs and The Exact Bits Its Spread Direction Must Come Out As */
+	struct FGoldenShot
+	{
+		uint32 Seed;
+		uint32 ShotIndex;
+		uint8 SpreadByte;
+		FVector AimDirection;
+		uint64 Expected[3];
+	};
+
+	// Checked In Bit Patterns, Generated With Floating Point Contraction Off. Any Build Or Platform That Fuses
+	// Multiply-Adds, Reorders The Math Or Uses A Different Sqrt Fails Here Instead Of Desyncing Server and Clients.
+	// Only Regenerate These On Purpose, Every Shipped Build Has To Agree With Them
+	static const FGoldenShot GoldenShots[] =
+	{
+		{ 0x00000000u, 0x00000000u, 64, FVector(1.0, 0.0, 0.0), { 0x3FEFFEE43FAEE4C0ull, 0x3F26DB354CFE0FA9ull, 0x3F90D7E920239AA7ull } },
+		{ 0x00000001u, 0x00000001u, 255, FVector(0.0, 0.0, 1.0), { 0xBF7AA0899FEF71C2ull, 0x3FCCA5AB63A54768ull, 0x3FEF3005A7ABFACFull } },
+		{ 0x01000193u, 0x00000007u, 13, FVector(0.6, 0.0, 0.8), { 0x3FE3254971FA0AFBull, 0xBF6D3A981433D686ull, 0x3FE9A3F25BBC195Cull } },
+		{ 0x00003039u, 0x000003E8u, 128, FVector(0.0, -0.6, 0.8), { 0x3FAB93BE84F90E18ull, 0xBFE37A355384DF97ull, 0x3FE954BE6F5E480Bull } },
+		{ 0xDEADBEEFu, 0x0000002Au, 1, FVector(-0.48, 0.6, 0.64), { 0xBFDEBDE522CED228ull, 0x3FE332AEC33497E1ull, 0x3FE47945F9923832ull } },
+		{ 0x00000007u, 0xFFFFFFFFu, 200, FVector(0.0, 1.0, 0.0), { 0x3FC21645601E3079ull, 0x3FEFADB2832B7E3Eull, 0x3F74ADA9FD095643ull } },
+	};
+
+	for (const FGoldenShot& Golden : GoldenShots)
+	{
+		const FVector Direction = FShooterSpread::ApplySpread(Golden.AimDirection, FShooterSpread::GetDiscSample(Golden.Seed, Golden.ShotIndex), Golden.SpreadByte);
+
+		// Compare Bits, Not Values, So -0 vs 0 Or A Last Bit Difference Still Fails
+		const double Components[3] = { Direction.X, Direction.Y, Direction.Z };
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			uint64 Bits;
+			FMemory::Memcpy(&Bits, &Components[Axis], sizeof(Bits));
+			if (Bits != Golden.Expected[Axis])
+			{
+				AddError(FString::Printf(TEXT("Seed %08x Shot %u Byte %u axis %d: got %016llx expected %016llx"), Golden.Seed, Golden.ShotIndex, Golden.SpreadByte, Axis, Bits, Golden.Expected[Axis]));
+			}
+		}
+	}
+
+	// Spread Byte 0 Must Leave The Aim Untouched and Dequantizing Must Be Exact
+	const FVector Forward = FVector::ForwardVector;
+	const FVector Unspread = FShooterSpread::ApplySpread(Forward, FVector2D(1.f, 0.f), 0);
+	TestTrue(TEXT("Zero spread keeps aim"), FMemory::Memcmp(&Forward, &Unspread, sizeof(FVector)) == 0);
+	TestEqual(TEXT("Spread byte round trips"), FShooterSpread::QuantizeSpread(FMath::RadiansToDegrees(FMath::Atan(FShooterSpread::GetConeRadius(40)))), static_cast<uint8>(40));
+	return !HasAnyErrors();
+}
+
+#endif